@@ -0,0 +1,8 @@
+#! /usr/bin/env python3
+
+# Programs that are runnable.
+ns3_runnable_programs = ['ns-3.35/build/scratch/ns3.35-flexcomm-debug', 'ns-3.35/build/scratch/ns3.35-ofswitch13-first-debug', 'ns-3.35/build/scratch/ns3.35-ecofen-simple-debug', 'ns-3.35/build/scratch/ns3.35-trace-to-csv-debug', 'ns-3.35/build/scratch/subdir/ns3.35-subdir-debug', 'ns-3.35/build/scratch/ns3.35-scratch-simulator-debug']
+
+# Scripts that are runnable.
+ns3_runnable_scripts = []
+
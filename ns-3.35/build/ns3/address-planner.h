@@ -0,0 +1,75 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef ADDRESS_PLANNER_H
+#define ADDRESS_PLANNER_H
+
+#include "ns3/core-module.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/net-device.h"
+#include "ns3/node.h"
+
+namespace ns3 {
+
+/**
+ * \brief Allocates the addresses of the host interfaces.
+ *
+ * Each edge switch gets the next subnet of prefixLength bits out of the
+ * supernet, recorded in Topology, and its hosts the next addresses of that
+ * subnet. Host interfaces use the supernet mask, every host staying
+ * reachable on-link. With a prefix length equal to the supernet one, all the
+ * hosts share the supernet, in link order.
+ */
+class AddressPlanner
+{
+public:
+  /**
+   * \param supernet The supernet, e.g. "10.0.0.0/8".
+   * \param prefixLength The length of the subnet of each edge switch.
+   */
+  AddressPlanner (std::string supernet, uint32_t prefixLength);
+
+  /**
+   * Assign the next address of the subnet of an edge switch to a host
+   * device, aborts when the subnet or the supernet is exhausted.
+   *
+   * \returns The address assigned.
+   */
+  Ipv4Address Assign (Ptr<NetDevice> device, Ptr<Node> edge);
+
+private:
+  struct Subnet
+  {
+    uint32_t offset; //!< Offset of the subnet in the supernet
+    uint32_t nHosts;
+  };
+
+  Ipv4Address m_supernet;
+  uint32_t m_supernetLength;
+  uint32_t m_prefixLength;
+  uint32_t m_nSubnets;
+  std::map<Ptr<Node>, Subnet> m_subnets;
+};
+
+} // namespace ns3
+
+#endif /* ADDRESS_PLANNER_H */
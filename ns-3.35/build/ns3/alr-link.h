@@ -0,0 +1,121 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 CNRS, France.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Anne-Cecile Orgerie <anne-cecile.orgerie@irisa.fr>
+ */
+
+#ifndef ALR_LINK_H
+#define ALR_LINK_H
+
+#include <vector>
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+#include "ns3/type-id.h"
+#include "ns3/packet.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/data-rate.h"
+#include "ns3/net-device-container.h"
+#include "ns3/point-to-point-ethernet-net-device.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup energy
+ * \brief Adaptive Link Rate on a point to point Ethernet link.
+ *
+ * Dual threshold policy driven by the events of the two net devices: the
+ * link steps up to the next declared rate once a queue holds HighThreshold
+ * packets, and steps down once both transmitters are idle. Transmissions are
+ * held while the link changes its rate, the link is evaluated again once the
+ * change is done, so an idle link keeps stepping down to its lowest rate. The
+ * energy of each rate is given by the net device energy model (e.g. the
+ * dataRate interface model), each change closing the period at the previous
+ * rate and switching for SwitchTime with SwitchEnergy.
+ */
+class AlrLink : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+  AlrLink ();
+  virtual ~AlrLink ();
+  /**
+   * \brief Sets the net devices of the link and hooks their transmit events.
+   *
+   * \param link The two PointToPointEthernetNetDevice of the link.
+   */
+  void SetLink (NetDeviceContainer link);
+  /**
+   * \returns The net devices of the link.
+   */
+  NetDeviceContainer GetLink (void) const;
+  /**
+   * To declare the different available transmission rates.
+   * The current rate of the link is always available.
+   */
+  void DeclareRates (std::vector<DataRate> rates);
+  /**
+   * To change the rate of the link. Nothing is done if the link already
+   * runs at this rate.
+   *
+   * \param rate Value of the new rate of the link.
+   */
+  void ChangeState (DataRate rate);
+  /**
+   * To decrease the rate of a link.
+   */
+  void DecreaseSpeed (void);
+  /**
+   * To increase the rate of a link.
+   */
+  void IncreaseSpeed (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * A packet is being sent by one of the net devices.
+   */
+  void NotifyTxRequest (Ptr<const Packet> packet);
+  /**
+   * One of the net devices went idle with an empty queue.
+   */
+  void NotifyTxIdle (void);
+  /**
+   * Step up or down according to the current queues of the net devices.
+   */
+  void Evaluate (void);
+  /**
+   * \returns true while the link is changing its rate.
+   */
+  bool IsSwitching (void) const;
+
+  NetDeviceContainer m_link;
+  Ptr<PointToPointEthernetNetDevice> m_netdevs[2];
+  Time m_lastChange;
+  Time m_switchTime;
+  double m_switchEnergy;
+  EventId m_evaluateEvent;
+  uint32_t m_highThreshold;
+  std::vector<DataRate> m_rates;
+  uint32_t m_rate; //!< Index of the current rate in m_rates
+};
+
+} // namespace ns3
+
+#endif /* ALR_LINK_H */
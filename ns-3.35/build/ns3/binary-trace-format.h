@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef BINARY_TRACE_FORMAT_H
+#define BINARY_TRACE_FORMAT_H
+
+#include "trace-format.h"
+
+namespace ns3 {
+
+/**
+ * \brief Columnar binary traces, read back by TraceReader.
+ *
+ * A trace is a header followed by a block per tick, i.e. per run of rows
+ * sharing the same time. All values are in the native byte order.
+ *
+ * Header:
+ *   char[8] magic, uint32 version, uint8 flags,
+ *   string entityColumn,
+ *   uint32 nColumns, then per column: string name, uint8 type,
+ *   uint32 nEntities, then per entity: string name.
+ *
+ * Block:
+ *   double time, uint32 nRows, uint32 entity[nRows],
+ *   then per column: 8 byte value[nRows], a double or an uint64.
+ *
+ * Strings are an uint32 size followed by their bytes. With the ZLIB flag,
+ * the blocks are a single zlib stream.
+ */
+class BinaryTraceFormat : public TraceFormat
+{
+public:
+  static const char MAGIC[8];
+  static const uint32_t VERSION = 1;
+
+  enum Flags : uint8_t { ZLIB = 1 };
+
+  /**
+   * \param compress Whether to compress the blocks, aborts if zlib is
+   * missing.
+   */
+  BinaryTraceFormat (bool compress = false);
+  ~BinaryTraceFormat ();
+
+  std::string GetExtension (void) const;
+  void FormatHeader (std::string &out, const TraceSchema &schema,
+                     const std::vector<std::string> &entities);
+  void FormatRow (std::string &out, const TraceSchema &schema,
+                  const std::vector<std::string> &entities, const TraceRow &row);
+  void FormatFooter (std::string &out, const TraceSchema &schema);
+
+private:
+  struct Deflater;
+
+  /**
+   * Append the pending block, compressed or not.
+   */
+  void FormatBlock (std::string &out, const TraceSchema &schema);
+  void Compress (std::string &out, bool finish);
+
+  Deflater *m_deflater; //!< Null when uncompressed
+  std::vector<TraceRow> m_rows; //!< Of the pending block
+  std::string m_block; //!< Raw bytes of the block, when compressed
+};
+
+} // namespace ns3
+
+#endif /* BINARY_TRACE_FORMAT_H */
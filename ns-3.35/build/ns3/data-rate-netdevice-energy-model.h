@@ -0,0 +1,76 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef DATA_RATE_NETDEVICE_ENERGY_MODEL_H_
+#define DATA_RATE_NETDEVICE_ENERGY_MODEL_H_
+
+#include "netdevice-energy-model.h"
+#include "state-timeline.h"
+#include "ns3/point-to-point-ethernet-net-device.h"
+
+namespace ns3 {
+
+class DataRateNetdeviceEnergyModel : public NetdeviceEnergyModel
+{
+public:
+  static TypeId GetTypeId (void);
+  DataRateNetdeviceEnergyModel ();
+  virtual ~DataRateNetdeviceEnergyModel ();
+
+  void Initialize ();
+
+  void SetUnit (uint64_t bps);
+  void SetConsumptionValues (std::map<uint64_t, double> values);
+  /**
+   * \param conso Power (W) drawn in any state other than off and on, i.e.
+   * while the link is in Low Power Idle.
+   */
+  void SetLpiConsumption (double conso);
+
+  virtual void SetNetdevice (Ptr<NetDevice> netdevice);
+  virtual Ptr<NetDevice> GetNetdevice (void) const;
+  virtual double GetPowerConsumption (void);
+  virtual void UpdateState (uint32_t state, double energy, Time duration);
+
+private:
+  /**
+   * \param bps Data rate of the interface.
+   * \param usage Fraction of the time the interface transmitted.
+   * \returns Power consumption (in Watts) when on.
+   */
+  double GetOnPower (uint64_t bps, double usage);
+  double GetStatePower (uint32_t state);
+  double GetPeriodEnergy (const StateTimeline::Period &period, double seconds, bool ongoing);
+
+  Ptr<NetDevice> m_netdevice;
+  Ptr<PointToPointEthernetNetDevice> m_device;
+  uint64_t m_installRate; //!< Data rate of the interface when the model was installed
+  uint64_t m_unit;
+  std::map<uint64_t, double> m_values;
+  double m_lpiConso;
+  Time m_lastBusyTime; //!< Transmit busy time at the last update or switch
+  StateTimeline m_timeline;
+};
+
+} // namespace ns3
+
+#endif /* DATA_RATE_NETDEVICE_ENERGY_MODEL_H_ */
@@ -0,0 +1,40 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_ECOFEN
+    
+
+// Module headers:
+#include "agenda-helper.h"
+#include "agenda.h"
+#include "alr-link.h"
+#include "basic-netdevice-energy-helper.h"
+#include "basic-netdevice-energy-model.h"
+#include "basic-node-energy-helper.h"
+#include "basic-node-energy-model.h"
+#include "complete-netdevice-energy-helper.h"
+#include "complete-netdevice-energy-model.h"
+#include "consumption-logger.h"
+#include "cpu-load-based-discrete-energy-helper.h"
+#include "cpu-load-based-discrete-energy-model.h"
+#include "cpu-load-based-energy-helper.h"
+#include "cpu-load-based-energy-model.h"
+#include "data-rate-netdevice-energy-helper.h"
+#include "data-rate-netdevice-energy-model.h"
+#include "enabled-ports-energy-helper.h"
+#include "enabled-ports-energy-model.h"
+#include "linear-netdevice-energy-helper.h"
+#include "linear-netdevice-energy-model.h"
+#include "lpi-link.h"
+#include "netdevice-energy-helper.h"
+#include "netdevice-energy-model.h"
+#include "node-energy-helper.h"
+#include "node-energy-model.h"
+#include "on-off-netdevice-helper.h"
+#include "on-off-netdevice.h"
+#include "on-off-node-helper.h"
+#include "on-off-node.h"
+#include "state-timeline.h"
+#endif
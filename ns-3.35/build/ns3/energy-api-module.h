@@ -0,0 +1,15 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_ENERGY_API
+    
+
+// Module headers:
+#include "energy-api-helper.h"
+#include "energy-api-server.h"
+#include "energy-api.h"
+#include "series-file.h"
+#include "time-series.h"
+#endif
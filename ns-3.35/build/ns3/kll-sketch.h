@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef KLL_SKETCH_H
+#define KLL_SKETCH_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief KLL streaming quantile sketch.
+ *
+ * Keeps the values in levels of compactors, a value at level h standing for
+ * 2^h values. A full compactor is sorted and every other value of it, from a
+ * random offset, is promoted to the next level, so the sketch holds O(k)
+ * values whatever the number of updates, with a rank error of about
+ * 1.65 / k. The offsets come from a fixed seed generator apart from the
+ * simulation ones, keeping runs reproducible. Sketches of disjoint streams merge into a sketch of their
+ * union.
+ */
+class KllSketch
+{
+public:
+  static const uint32_t DEFAULT_K = 200;
+
+  /**
+   * \param k The capacity of the top compactor, trading space for accuracy.
+   */
+  explicit KllSketch (uint32_t k = DEFAULT_K);
+
+  void Update (double value);
+  void Merge (const KllSketch &other);
+
+  /**
+   * \param rank In [0, 1].
+   * \returns The value of that rank among the updates, exact while fewer
+   * than k values were added. NaN if empty.
+   */
+  double GetQuantile (double rank) const;
+
+  /**
+   * \returns The number of updates, merged ones included.
+   */
+  uint64_t GetN (void) const;
+
+private:
+  uint32_t GetCapacity (uint32_t level) const;
+  void Compress (void);
+  void Compact (uint32_t level);
+  uint32_t NextOffset (void);
+
+  uint32_t m_k;
+  uint64_t m_n;
+  std::vector<std::vector<double>> m_levels;
+  uint64_t m_random; //!< State of the offset generator
+};
+
+} // namespace ns3
+
+#endif /* KLL_SKETCH_H */
@@ -0,0 +1,69 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2023 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef LINK_STATS_LOGGER_H
+#define LINK_STATS_LOGGER_H
+
+#include "ns3/channel-container.h"
+#include "ns3/core-module.h"
+#include "ns3/trace-writer.h"
+
+namespace ns3 {
+
+class LinkStatsLogger : public Object
+{
+public:
+  LinkStatsLogger ();
+  virtual ~LinkStatsLogger ();
+
+  void ComputeStats (Time interval, Time stop, Ptr<Channel> channel);
+  void ComputeStats (Time interval, Time stop, ChannelContainer c);
+  void ComputeStatsAll (Time interval, Time stop);
+
+  void ComputeStatsLog (Time interval, Time stop, Ptr<Channel> channel,
+                        std::string path = "link-stats", std::string format = "csv");
+  void ComputeStatsLog (Time interval, Time stop, ChannelContainer c,
+                        std::string path = "link-stats", std::string format = "csv");
+  void ComputeStatsAllLog (Time interval, Time stop, std::string path = "link-stats",
+                           std::string format = "csv");
+
+  /**
+   * Log the summaries of the link usage over windows, once the log file is
+   * created.
+   */
+  void SetWindow (TraceWindow window);
+
+private:
+  void CreateLogFile (std::string path, std::string format);
+  static void UpdateUsage (Ptr<Channel> channel);
+  void Compute ();
+  void Log ();
+
+  static Ptr<TraceWriter> m_writer;
+  static ChannelContainer m_links;
+  static ChannelContainer m_linksLog;
+  static std::vector<uint32_t> m_entities; //!< Trace entity of each logged link
+};
+
+} // namespace ns3
+
+#endif /* LINK_STATS_LOGGER_H */
@@ -0,0 +1,13 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_LINK_STATS
+    
+
+// Module headers:
+#include "link-stats-helper.h"
+#include "link-stats-logger.h"
+#include "link-stats.h"
+#endif
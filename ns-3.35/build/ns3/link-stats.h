@@ -0,0 +1,72 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2023 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef LINK_STATS_H
+#define LINK_STATS_H
+
+#include "ns3/core-module.h"
+#include "ns3/channel.h"
+#include "ns3/metric-history.h"
+#include "ns3/trace-writer.h"
+
+namespace ns3 {
+
+class LinkStats : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+  LinkStats ();
+  virtual ~LinkStats ();
+
+  static TraceSchema GetTraceSchema (void);
+
+  void LogStats (Time interval, Time stop, Ptr<TraceWriter> writer);
+  void LogStatsInternal (Ptr<TraceWriter> writer, uint32_t entity);
+  void SetChannel (Ptr<Channel> channel);
+
+  /**
+   * Update the usage of the channel and keep it in the usage history.
+   */
+  void UpdateUsage (void);
+
+  /**
+   * \returns The mean usage of the updates in the last window, 0 without
+   * any.
+   */
+  double GetUtilisation (Time window) const;
+
+  /**
+   * \returns Up to the n last usage updates, oldest first.
+   */
+  std::vector<MetricHistory<double>::Sample> GetUsageSeries (uint32_t n) const;
+
+private:
+  void SetHistorySize (uint32_t size);
+  uint32_t GetHistorySize (void) const;
+
+  Ptr<Channel> m_channel;
+  MetricHistory<double> m_usage;
+};
+
+} // namespace ns3
+
+#endif /* LINK_STATS_H */
@@ -0,0 +1,113 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 CNRS, France.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Anne-Cecile Orgerie <anne-cecile.orgerie@irisa.fr>
+ */
+
+#ifndef LPI_LINK_H
+#define LPI_LINK_H
+
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+#include "ns3/type-id.h"
+#include "ns3/packet.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/net-device-container.h"
+#include "ns3/point-to-point-ethernet-net-device.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup energy
+ * \brief Low Power Idle (IEEE 802.3az) on a point to point Ethernet link.
+ *
+ * The link is driven by the events of its two net devices: it goes to sleep
+ * once both transmitters are idle (after an optional idle time) and wakes up
+ * as soon as a packet is handed to one of them. Transmissions are held while
+ * the PHYs wake up. The link is evaluated again once a switch is done, and
+ * at the start for links carrying no traffic. Refresh cycles done while
+ * sleeping are accounted for when the link wakes up, so a sleeping link
+ * schedules no event.
+ */
+class LpiLink : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+  LpiLink ();
+  virtual ~LpiLink ();
+  /**
+   * \brief Sets the net devices of the link and hooks their transmit events.
+   *
+   * \param link The two PointToPointEthernetNetDevice of the link.
+   */
+  void SetLink (NetDeviceContainer link);
+  /**
+   * \returns The net devices of the link.
+   */
+  NetDeviceContainer GetLink (void) const;
+  /**
+   * \returns true if the link is sleeping.
+   */
+  bool IsSleeping (void) const;
+  /**
+   * To put the two net devices to sleep.
+   */
+  void PutToSleep (void);
+  /**
+   * To wake up the two net devices.
+   */
+  void WakeUp (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * A packet was handed to one of the net devices.
+   */
+  void NotifyTxRequest (Ptr<const Packet> packet);
+  /**
+   * One of the net devices went idle with an empty queue.
+   */
+  void NotifyTxIdle (void);
+  /**
+   * Forward a switch to (or from) the sleep state to the energy models of
+   * the two net devices.
+   */
+  void UpdateEnergy (bool sleep, double energy, Time duration);
+
+  NetDeviceContainer m_link;
+  Ptr<PointToPointEthernetNetDevice> m_netdevs[2];
+  uint32_t m_state;
+  Time m_lastChange;
+  EventId m_sleepEvent;
+  EventId m_evaluateEvent;
+  Time m_timeIdle; // T_i, idle time before going to sleep
+  Time m_timeToSleep; // T_s
+  Time m_timeToWakeUp; // T_w
+  Time m_timeToRefresh; // T_r
+  Time m_timeQuiet; // T_q
+  double m_energyToSleep;
+  double m_energyToWakeUp;
+  double m_energyToRefresh;
+  uint32_t m_lpiStateNb;
+};
+
+} // namespace ns3
+
+#endif /* LPI_LINK_H */
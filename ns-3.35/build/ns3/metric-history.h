@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef METRIC_HISTORY_H
+#define METRIC_HISTORY_H
+
+#include <cstdint>
+#include <vector>
+#include "ns3/assert.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+
+/**
+ * \brief The most recent samples of a metric, in a ring buffer.
+ *
+ * Appending is O(1), the oldest sample being overwritten once the series
+ * is full. Samples are appended in time order, so the ones taken since a
+ * given time are found by binary search.
+ */
+template <typename T>
+class MetricHistory
+{
+public:
+  struct Sample
+  {
+    Time time;
+    T value;
+  };
+
+  /**
+   * \param capacity The samples kept at most.
+   */
+  explicit MetricHistory (uint32_t capacity);
+
+  /**
+   * Drops every sample.
+   */
+  void SetCapacity (uint32_t capacity);
+  uint32_t GetCapacity (void) const;
+  uint32_t GetSize (void) const;
+
+  void Append (Time time, const T &value);
+
+  /**
+   * \param age 0 for the newest sample, up to GetSize () - 1.
+   */
+  const Sample &Get (uint32_t age) const;
+
+  /**
+   * \returns Up to the n newest samples, oldest first.
+   */
+  std::vector<Sample> GetLast (uint32_t n) const;
+
+  /**
+   * \returns The number of samples taken after a time.
+   */
+  uint32_t CountSince (Time since) const;
+
+private:
+  std::vector<Sample> m_samples;
+  uint32_t m_next; //!< Slot of the next sample
+  uint32_t m_size;
+};
+
+template <typename T>
+MetricHistory<T>::MetricHistory (uint32_t capacity) : m_samples (capacity), m_next (0), m_size (0)
+{
+}
+
+template <typename T>
+void
+MetricHistory<T>::SetCapacity (uint32_t capacity)
+{
+  m_samples.assign (capacity, Sample ());
+  m_next = 0;
+  m_size = 0;
+}
+
+template <typename T>
+uint32_t
+MetricHistory<T>::GetCapacity (void) const
+{
+  return m_samples.size ();
+}
+
+template <typename T>
+uint32_t
+MetricHistory<T>::GetSize (void) const
+{
+  return m_size;
+}
+
+template <typename T>
+void
+MetricHistory<T>::Append (Time time, const T &value)
+{
+  if (m_samples.empty ())
+    return;
+
+  m_samples[m_next] = {time, value};
+  m_next = m_next + 1 == m_samples.size () ? 0 : m_next + 1;
+  if (m_size < m_samples.size ())
+    m_size++;
+}
+
+template <typename T>
+const typename MetricHistory<T>::Sample &
+MetricHistory<T>::Get (uint32_t age) const
+{
+  NS_ASSERT (age < m_size);
+  uint32_t slot = m_next + m_samples.size () - 1 - age;
+  return m_samples[slot < m_samples.size () ? slot : slot - m_samples.size ()];
+}
+
+template <typename T>
+std::vector<typename MetricHistory<T>::Sample>
+MetricHistory<T>::GetLast (uint32_t n) const
+{
+  n = n < m_size ? n : m_size;
+  std::vector<Sample> samples;
+  samples.reserve (n);
+  for (uint32_t age = n; age > 0; age--)
+    samples.push_back (Get (age - 1));
+  return samples;
+}
+
+template <typename T>
+uint32_t
+MetricHistory<T>::CountSince (Time since) const
+{
+  // Ages [0, low) are after since, ages [high, m_size) are not
+  uint32_t low = 0;
+  uint32_t high = m_size;
+  while (low < high)
+    {
+      uint32_t mid = low + (high - low) / 2;
+      if (Get (mid).time > since)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+  return low;
+}
+
+} // namespace ns3
+
+#endif /* METRIC_HISTORY_H */
@@ -0,0 +1,30 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_OFSWITCH13
+    
+
+// Module headers:
+#include "link-state-db.h"
+#include "ofswitch13-controller.h"
+#include "ofswitch13-device-container.h"
+#include "ofswitch13-device.h"
+#include "ofswitch13-external-helper.h"
+#include "ofswitch13-helper.h"
+#include "ofswitch13-interface.h"
+#include "ofswitch13-internal-helper.h"
+#include "ofswitch13-learning-controller.h"
+#include "ofswitch13-pcap-writer.h"
+#include "ofswitch13-port.h"
+#include "ofswitch13-priority-queue.h"
+#include "ofswitch13-queue.h"
+#include "ofswitch13-socket-handler.h"
+#include "ofswitch13-stats-calculator.h"
+#include "queue-tag.h"
+#include "route-aggregator.h"
+#include "simple-controller-flex.h"
+#include "simple-controller.h"
+#include "tunnel-id-tag.h"
+#endif
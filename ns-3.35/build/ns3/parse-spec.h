@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef PARSE_SPEC_H
+#define PARSE_SPEC_H
+
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "ns3/core-module.h"
+#include "toml.hpp"
+
+namespace ns3 {
+
+/*
+ * Intermediate representation of a topology. The entries point into the
+ * parsed tables, owned by the spec, instead of copying them, and refer to
+ * nodes by their index in TopologySpec::nodes.
+ */
+
+struct NodeSpec
+{
+  std::string_view name;
+  const toml::table *configs;
+  bool host;
+};
+
+struct LinkSpec
+{
+  std::string_view name;
+  const toml::table *configs;
+  uint32_t edges[2];
+};
+
+struct AppSpec
+{
+  std::string_view name;
+  const toml::table *configs;
+  std::string_view type;
+  uint32_t host;
+  uint32_t remote;
+};
+
+struct TopologySpec
+{
+  toml::table nodesTable;
+  toml::table linksTable;
+  toml::table appsTable;
+  toml::table configsTable;
+
+  // Energy templates, the topology ones overriding the default ones
+  toml::table defaultTemplatesTable;
+  toml::table templatesTable;
+  bool hasDefaultTemplates;
+  bool hasTemplates;
+
+  // In file order, i.e. sorted by name
+  std::vector<NodeSpec> nodes;
+  std::vector<LinkSpec> links;
+  std::vector<AppSpec> apps;
+
+  std::unordered_map<std::string_view, uint32_t> nodeIndex;
+};
+
+/**
+ * Parse and validate the topology files into a spec, in parallel across the
+ * files and across shards of their entries. Aborts on the first invalid
+ * entry, nothing is instantiated.
+ */
+void parseSpec (std::string topoName, TopologySpec &spec);
+
+/**
+ * \returns The files read by parseSpec, existing or not.
+ */
+std::vector<std::string> getSpecInputs (std::string topoName);
+
+} // namespace ns3
+
+#endif /* PARSE_SPEC_H */
@@ -0,0 +1,13 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+#ifndef PARSER_HELPER_H
+#define PARSER_HELPER_H
+
+#include "ns3/parser.h"
+
+namespace ns3 {
+
+/* ... */
+
+}
+
+#endif /* PARSER_HELPER_H */
@@ -0,0 +1,23 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_PARSER
+    
+
+// Module headers:
+#include "address-planner.h"
+#include "json.hpp"
+#include "parse-apps.h"
+#include "parse-configs.h"
+#include "parse-energy.h"
+#include "parse-links.h"
+#include "parse-nodes.h"
+#include "parse-spec.h"
+#include "parse-templates.h"
+#include "parser-helper.h"
+#include "parser.h"
+#include "spec-cache.h"
+#include "toml.hpp"
+#endif
@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef SERIES_FILE_H
+#define SERIES_FILE_H
+
+#include <string>
+#include "ns3/simple-ref-count.h"
+#include "time-series.h"
+
+namespace ns3 {
+
+/**
+ * \brief Read-only memory mapping of a binary series file.
+ *
+ * The file, written by utils/energy-to-bin.py, stores little-endian
+ * values:
+ *
+ * - a 32 bytes header: magic "FXSERIES", version (u32), number of series
+ *   (u32), offset and size of the names block (u64, u64);
+ * - an index of 48 bytes per series: offset and number of values (u64,
+ *   u64), start and step in nanoseconds (i64, i64), offset in the names
+ *   block and length of the name (u32, u32), boundary and interpolation
+ *   (u32, u32);
+ * - the names block;
+ * - the values of each series, as a contiguous column of 32 bits floats
+ *   aligned on 8 bytes.
+ *
+ * Opening a file only maps it, the values are read from the page cache and
+ * shared by every process mapping the same file.
+ */
+class SeriesFile : public SimpleRefCount<SeriesFile>
+{
+public:
+  /**
+   * Map a series file, aborts if it cannot be read or is malformed.
+   */
+  SeriesFile (std::string path);
+  ~SeriesFile ();
+
+  /**
+   * \returns true if the file starts with the series file magic.
+   */
+  static bool Probe (std::string path);
+
+  uint32_t GetN (void) const;
+  std::string GetName (uint32_t i) const;
+
+  /**
+   * \returns The series i, pointing to the mapped values.
+   */
+  TimeSeries Get (uint32_t i) const;
+
+private:
+  struct Header
+  {
+    char magic[8];
+    uint32_t version;
+    uint32_t nSeries;
+    uint64_t namesOffset;
+    uint64_t namesSize;
+  };
+
+  struct Entry
+  {
+    uint64_t valuesOffset;
+    uint64_t nValues;
+    int64_t start;
+    int64_t step;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t boundary;
+    uint32_t interpolation;
+  };
+
+  const Entry &GetEntry (uint32_t i) const;
+
+  std::string m_path;
+  const uint8_t *m_data;
+  size_t m_size;
+};
+
+} // namespace ns3
+
+#endif /* SERIES_FILE_H */
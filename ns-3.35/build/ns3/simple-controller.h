@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2023 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef SIMPLE_CONTROLLER_H
+#define SIMPLE_CONTROLLER_H
+
+#include <set>
+#include "ofswitch13-controller.h"
+#include "link-state-db.h"
+#include "route-aggregator.h"
+
+namespace ns3 {
+
+class SimpleController : public OFSwitch13Controller
+{
+public:
+  /**
+   * How the host routes of a switch are installed.
+   */
+  enum RouteAggregation {
+    NONE, //!< One rule per host
+    EXACT, //!< Minimal rule set, unknown destinations still reach the controller
+    COMPACT //!< Minimal rule set, unknown destinations may match any rule
+  };
+
+  /**
+   * What the switches forward on.
+   */
+  enum Routing {
+    DESTINATION, //!< Destination address, every switch holds a rule per host
+    LABEL //!< Egress switch label, set by the ingress switch in the tunnel id
+  };
+
+  /**
+   * Which next hops traffic is spread over, by hashing flows in select groups.
+   */
+  enum Multipath {
+    SHORTEST_PATH, //!< A single shortest path
+    EQUAL_COST, //!< Every shortest path, weighted by link capacity
+    WEIGHTED //!< Every loop-free next hop, weighted by link capacity over path cost
+  };
+
+  SimpleController ();
+  virtual ~SimpleController ();
+  static TypeId GetTypeId (void);
+  virtual void DoDispose ();
+
+  ofl_err HandlePortStatus (struct ofl_msg_port_status *msg, Ptr<const RemoteSwitch> swtch,
+                            uint32_t xid);
+
+  /**
+   * Install the default rules and the routes of every switch straight into
+   * its datapath, before the simulation starts. The switches still connect,
+   * for later updates, but skip their handshake rules.
+   */
+  virtual void Preinstall (void);
+
+protected:
+  void HandshakeSuccessful (Ptr<const RemoteSwitch> sw);
+  void InstallDefaultRules (uint64_t swDpId);
+  void ApplyRouting (uint64_t src);
+
+private:
+  typedef std::vector<std::pair<uint32_t, uint16_t>> Buckets; //!< Port and weight
+
+  struct SwitchGroups
+  {
+    std::map<std::string, uint32_t> ids; //!< By type and buckets
+    uint32_t lastId = 0;
+  };
+
+  /**
+   * Flags the hops that are group IDs instead of ports.
+   */
+  static const uint32_t GROUP_HOP = 0x80000000;
+  static const uint16_t MAX_BUCKET_WEIGHT = 100;
+
+  /**
+   * \returns The output port towards dst, a select group of ports with
+   * multipath routing or a fast-failover group of a port and its backup,
+   * installed if needed. NO_HOP if dst is unreachable.
+   */
+  uint32_t GetNextHop (uint64_t swDpId, Ptr<Node> sw, Ptr<Node> dst);
+  uint32_t GetGroup (uint64_t swDpId, std::string type, std::string buckets);
+  std::string HopAction (uint32_t hop);
+  void ReleaseGroups (uint64_t swDpId);
+
+  /**
+   * Install the routes of a switch towards some destinations, hosts or, with
+   * label routing, edge switches.
+   */
+  void InstallRoutes (uint64_t swDpId, const std::vector<Ptr<Node>> &dsts);
+  void ApplyAggregatedRouting (uint64_t swDpId, const std::map<Ipv4Address, uint32_t> &routes);
+  void InstallLabelClassifier (uint64_t swDpId);
+  void FindHostEdges (void);
+
+  /**
+   * Recompute some routes after RerouteDelay, together with those of the
+   * link state changes until then.
+   */
+  void ScheduleReroute (const LinkStateDb::RouteSet &routes);
+  void Reroute (void);
+
+  RouteAggregation m_aggregation;
+  std::map<uint64_t, Ptr<RouteAggregator>> m_aggregators; //!< Per switch datapath ID
+
+  Routing m_routing;
+  std::map<Ptr<Node>, Ptr<Node>> m_hostEdges; //!< Switch of each host
+  std::set<Ptr<Node>> m_edges; //!< Switches with hosts, i.e. the labels
+
+  /**
+   * Per switch datapath ID, the installed hop towards each destination.
+   */
+  std::map<uint64_t, std::map<Ptr<Node>, uint32_t>> m_hops;
+
+  Multipath m_multipath;
+  std::map<uint64_t, SwitchGroups> m_groups; //!< Per switch datapath ID
+
+  bool m_fastFailover;
+
+  Ptr<LinkStateDb> m_linkState;
+  Time m_rerouteDelay;
+  LinkStateDb::RouteSet m_pendingRoutes;
+  EventId m_rerouteEvent;
+
+  std::set<uint64_t> m_preinstalled; //!< Switches holding their rules before the handshake
+};
+
+} // namespace ns3
+
+#endif
@@ -0,0 +1,59 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef SPEC_CACHE_H
+#define SPEC_CACHE_H
+
+#include "ns3/core-module.h"
+#include "parse-spec.h"
+
+namespace ns3 {
+
+/*
+ * Binary snapshot of a validated TopologySpec, to reload a topology without
+ * parsing its TOML files. The snapshot stores the tables, in a tagged
+ * binary encoding, and the validated entries, under a key hashing the
+ * content of every input file (see getSpecInputs).
+ */
+
+/**
+ * \returns The key of the current content of the topology input files.
+ */
+uint64_t hashSpecInputs (std::string topoName);
+
+/**
+ * Load a snapshot into an empty spec.
+ *
+ * \returns false if the snapshot is missing, stale, of another version or
+ * malformed, the spec must then be parsed.
+ */
+bool readSpecCache (std::string path, uint64_t key, TopologySpec &spec);
+
+/**
+ * Write a snapshot of a spec, atomically replacing any previous one. Does
+ * nothing if the spec holds values the snapshot cannot encode.
+ */
+void writeSpecCache (std::string path, uint64_t key, const TopologySpec &spec);
+
+} // namespace ns3
+
+#endif /* SPEC_CACHE_H */
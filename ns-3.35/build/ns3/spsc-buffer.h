@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef SPSC_BUFFER_H
+#define SPSC_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief Bounded lock-free queue between a single producer thread and a
+ * single consumer thread.
+ *
+ * Each side only writes its own index and caches the index of the other
+ * side, reading it again only when the queue looks full, or empty.
+ */
+template <typename T>
+class SpscBuffer
+{
+public:
+  /**
+   * \param capacity The items held at once, rounded up to a power of two.
+   */
+  explicit SpscBuffer (uint32_t capacity);
+
+  /**
+   * Producer side.
+   * \returns false if the queue is full.
+   */
+  bool Push (const T &item);
+
+  /**
+   * Consumer side.
+   * \returns The oldest item, 0 if the queue is empty.
+   */
+  const T *Front (void);
+
+  /**
+   * Consumer side, release the item returned by Front.
+   */
+  void Pop (void);
+
+private:
+  std::vector<T> m_items;
+  uint64_t m_mask;
+
+  // Apart, so the producer and the consumer do not share cache lines
+  alignas (64) std::atomic<uint64_t> m_head; //!< Next item pushed
+  uint64_t m_cachedTail; //!< Producer copy of m_tail
+  alignas (64) std::atomic<uint64_t> m_tail; //!< Next item popped
+  uint64_t m_cachedHead; //!< Consumer copy of m_head
+};
+
+template <typename T>
+SpscBuffer<T>::SpscBuffer (uint32_t capacity)
+    : m_head (0), m_cachedTail (0), m_tail (0), m_cachedHead (0)
+{
+  uint64_t size = 1;
+  while (size < capacity)
+    size <<= 1;
+  m_items.resize (size);
+  m_mask = size - 1;
+}
+
+template <typename T>
+bool
+SpscBuffer<T>::Push (const T &item)
+{
+  uint64_t head = m_head.load (std::memory_order_relaxed);
+  if (head - m_cachedTail == m_items.size ())
+    {
+      m_cachedTail = m_tail.load (std::memory_order_acquire);
+      if (head - m_cachedTail == m_items.size ())
+        return false;
+    }
+
+  m_items[head & m_mask] = item;
+  m_head.store (head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+const T *
+SpscBuffer<T>::Front (void)
+{
+  uint64_t tail = m_tail.load (std::memory_order_relaxed);
+  if (tail == m_cachedHead)
+    {
+      m_cachedHead = m_head.load (std::memory_order_acquire);
+      if (tail == m_cachedHead)
+        return 0;
+    }
+  return &m_items[tail & m_mask];
+}
+
+template <typename T>
+void
+SpscBuffer<T>::Pop (void)
+{
+  m_tail.store (m_tail.load (std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+} // namespace ns3
+
+#endif /* SPSC_BUFFER_H */
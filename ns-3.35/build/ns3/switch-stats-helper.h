@@ -0,0 +1,47 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2023 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+#ifndef SWITCH_STATS_HELPER_H
+#define SWITCH_STATS_HELPER_H
+
+#include "ns3/switch-stats.h"
+
+namespace ns3 {
+
+class SwitchStatsHelper : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+  SwitchStatsHelper ();
+  virtual ~SwitchStatsHelper ();
+
+  void Install (Ptr<Node> node);
+  void Install (NodeContainer c);
+  void Install (std::string name);
+  void InstallAll ();
+
+private:
+  ObjectFactory m_factory;
+};
+
+} // namespace ns3
+
+#endif /* SWITCH_STATS_HELPER_H */
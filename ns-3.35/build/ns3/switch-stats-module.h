@@ -0,0 +1,13 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_SWITCH_STATS
+    
+
+// Module headers:
+#include "switch-stats-helper.h"
+#include "switch-stats-logger.h"
+#include "switch-stats.h"
+#endif
@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef TIME_SERIES_H
+#define TIME_SERIES_H
+
+#include <string>
+#include <vector>
+#include "ns3/nstime.h"
+
+namespace ns3 {
+
+/**
+ * \brief Regularly sampled series of values over simulated time.
+ *
+ * Sample i holds the value from Start + i * Step until the next sample.
+ * Past the horizon (the last sample) the series either wraps around or
+ * holds its last value, and it holds its first value before Start. Values
+ * can be read as steps or linearly interpolated between samples.
+ *
+ * The series does not own its samples, it only points to them. A change
+ * point index, built on the first GetNextChange (), gives the time of the
+ * next change in O(1).
+ */
+class TimeSeries
+{
+public:
+  /**
+   * What happens past the horizon
+   */
+  enum Boundary {
+    WRAP, /**< The series repeats itself */
+    HOLD /**< The last value is held */
+  };
+
+  /**
+   * How values between samples are computed
+   */
+  enum Interpolation {
+    STEP, /**< The value of the previous sample */
+    LINEAR /**< Linear interpolation between the surrounding samples */
+  };
+
+  TimeSeries (Time start = Seconds (0), Time step = Minutes (1), Boundary boundary = WRAP,
+              Interpolation interpolation = STEP);
+
+  /**
+   * Point the series to its samples and rebuild the change point index.
+   *
+   * \param data The samples, must outlive the series.
+   * \param size The number of samples.
+   */
+  void SetValues (const float *data, size_t size);
+
+  Time GetStart (void) const;
+  Time GetStep (void) const;
+  Boundary GetBoundary (void) const;
+  Interpolation GetInterpolation (void) const;
+
+  /**
+   * \returns The time covered by the samples, Step * size.
+   */
+  Time GetHorizon (void) const;
+
+  size_t GetSize (void) const;
+  const float *GetData (void) const;
+
+  /**
+   * \returns The value of the series at time t.
+   */
+  float GetValue (Time t) const;
+
+  /**
+   * \returns The first time after t at which the value changes, or
+   * Time::Max () if it never does.
+   */
+  Time GetNextChange (Time t) const;
+
+  /**
+   * Parse a boundary or interpolation name ("wrap", "hold", "step", "linear"),
+   * aborts on unknown names.
+   */
+  static Boundary ParseBoundary (std::string name);
+  static Interpolation ParseInterpolation (std::string name);
+
+private:
+  /**
+   * Find the sample active at time t. The index is -1 before Start and size
+   * or more past the horizon of a holding series. The base is the start of
+   * the current repetition of a wrapping series.
+   */
+  void Locate (Time t, int64_t &index, Time &base) const;
+
+  /**
+   * Build m_nextChange if the samples changed since it was last built.
+   */
+  void BuildChangeIndex (void) const;
+
+  Time m_start;
+  Time m_step;
+  Boundary m_boundary;
+  Interpolation m_interpolation;
+  const float *m_data;
+  size_t m_size;
+  mutable std::vector<uint32_t> m_nextChange; //!< Index of the next sample with another value
+};
+
+} // namespace ns3
+
+#endif /* TIME_SERIES_H */
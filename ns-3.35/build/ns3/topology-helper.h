@@ -0,0 +1,13 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+#ifndef TOPOLOGY_HELPER_H
+#define TOPOLOGY_HELPER_H
+
+#include "ns3/topology.h"
+
+namespace ns3 {
+
+/* ... */
+
+}
+
+#endif /* TOPOLOGY_HELPER_H */
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef TRACE_READER_H
+#define TRACE_READER_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "ns3/simple-ref-count.h"
+#include "trace-format.h"
+
+namespace ns3 {
+
+/**
+ * The rows of a tick, column by column.
+ */
+struct TraceBlock
+{
+  double time; //!< Seconds
+  std::vector<uint32_t> entities; //!< Entity index of each row
+  std::vector<std::vector<TraceValue>> columns; //!< A value per row, per column
+};
+
+/**
+ * \brief Reader of the binary traces written by BinaryTraceFormat, block by
+ * block or row by row.
+ *
+ * Aborts on files that are not binary traces, of another version,
+ * truncated or corrupted.
+ */
+class TraceReader : public SimpleRefCount<TraceReader>
+{
+public:
+  TraceReader (std::string path);
+  ~TraceReader ();
+
+  const TraceSchema &GetSchema (void) const;
+  const std::vector<std::string> &GetEntities (void) const;
+  bool IsCompressed (void) const;
+
+  /**
+   * Read the next tick. Not to be mixed with ReadRow.
+   * \returns false at the end of the trace.
+   */
+  bool ReadBlock (TraceBlock &block);
+
+  /**
+   * Read the next row, in the order they were written.
+   * \returns false at the end of the trace.
+   */
+  bool ReadRow (TraceRow &row);
+
+private:
+  struct Inflater;
+
+  /**
+   * Read exactly size bytes, decompressing them if needed.
+   * \returns false at the end of the trace, before any byte.
+   */
+  bool Read (void *data, size_t size);
+  template <typename T>
+  void Get (T &value);
+  void GetString (std::string &str);
+
+  std::string m_path;
+  std::ifstream m_file;
+  Inflater *m_inflater; //!< Null when uncompressed
+  TraceSchema m_schema;
+  std::vector<std::string> m_entities;
+
+  TraceBlock m_block; //!< Block of ReadRow
+  size_t m_next; //!< Next row of m_block
+};
+
+} // namespace ns3
+
+#endif /* TRACE_READER_H */
@@ -0,0 +1,19 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_TRACE_WRITER
+    
+
+// Module headers:
+#include "binary-trace-format.h"
+#include "kll-sketch.h"
+#include "metric-history.h"
+#include "spsc-buffer.h"
+#include "trace-aggregator.h"
+#include "trace-format.h"
+#include "trace-reader.h"
+#include "trace-writer-helper.h"
+#include "trace-writer.h"
+#endif
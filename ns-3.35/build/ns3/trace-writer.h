@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef TRACE_WRITER_H
+#define TRACE_WRITER_H
+
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include "ns3/simple-ref-count.h"
+#include "spsc-buffer.h"
+#include "trace-aggregator.h"
+#include "trace-format.h"
+
+namespace ns3 {
+
+/**
+ * \brief Asynchronous writer of a trace, i.e. rows of numeric values about
+ * some named entities over time.
+ *
+ * The simulation thread queues the rows in binary, on a bounded lock-free
+ * buffer, and a background thread shared by every writer formats them and
+ * writes them in batches. Entity names are interned before the first row,
+ * rows refer to them by index. If the buffer is full the simulation waits
+ * for the background thread. The pending rows are written on
+ * Simulator::Destroy.
+ */
+class TraceWriter : public SimpleRefCount<TraceWriter>
+{
+public:
+  static const uint32_t DEFAULT_CAPACITY = 1 << 14; //!< Rows
+
+  /**
+   * \param path The output file, without extension, that of the format is
+   * appended.
+   * \param format The output format, see TraceFormat::Create.
+   * \param schema The columns of the rows.
+   * \param capacity The rows queued at most.
+   */
+  TraceWriter (std::string path, std::string format, TraceSchema schema,
+               uint32_t capacity = DEFAULT_CAPACITY);
+  ~TraceWriter ();
+
+  /**
+   * Intern an entity name, before the first row is written.
+   * \returns The entity index to write its rows with.
+   */
+  uint32_t AddEntity (std::string name);
+
+  /**
+   * Write the summaries of the rows over windows instead of the rows, see
+   * TraceAggregator. Called before the first row is written.
+   */
+  void SetWindow (TraceWindow window);
+
+  /**
+   * Queue a row at the current simulation time, with a value per column.
+   */
+  void Write (uint32_t entity, std::initializer_list<TraceValue> values);
+
+  /**
+   * Write the pending rows and close the file. Scheduled on
+   * Simulator::Destroy.
+   */
+  void Close (void);
+
+private:
+  static const size_t BATCH_SIZE = 1 << 16; //!< Bytes formatted per file write
+
+  /**
+   * Background thread, draining every registered writer.
+   */
+  static void Run (void);
+  static void Register (TraceWriter *writer);
+  static void Unregister (TraceWriter *writer);
+
+  /**
+   * Format the queued rows, in the background thread.
+   * \returns Whether any row was queued.
+   */
+  bool Drain (void);
+  void Format (const TraceRow &row);
+  void Flush (void);
+
+  /**
+   * \returns The columns of the rows written to the file.
+   */
+  const TraceSchema &GetFileSchema (void) const;
+
+  std::ofstream m_file;
+  Ptr<TraceFormat> m_format;
+  TraceSchema m_schema;
+  std::vector<std::string> m_entities;
+  Ptr<TraceAggregator> m_aggregator; //!< Null when writing the rows
+  std::vector<TraceRow> m_summaries; //!< Returned by the aggregator
+
+  SpscBuffer<TraceRow> m_buffer;
+  bool m_writing; //!< Whether rows were written, the entities are then fixed
+  bool m_formatting; //!< Whether the header was formatted
+  bool m_closed;
+  std::string m_batch; //!< Formatted bytes not yet written
+};
+
+} // namespace ns3
+
+#endif /* TRACE_WRITER_H */
@@ -54,7 +54,6 @@ main (int argc, char *argv[])
     {
       GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::RealtimeSimulatorImpl"));
       checksum = true; // Override checksum option
-      EnergyAPI::StartExternalServer (topo, estiFile, flexFile);
     }
 
   GlobalValue::Bind ("ControllerType", StringValue (ctrl));
@@ -66,6 +65,9 @@ main (int argc, char *argv[])
 
   Parser::ParseTopology (topo, estiFile, flexFile, linkFailuresFile);
 
+  if (ctrl == "External")
+    EnergyAPI::StartServer ();
+
   endTime = clock.End ();
   uint64_t milli = endTime % 1000;
   uint64_t scds = (endTime / 1000) % 60;
@@ -98,5 +100,6 @@ main (int argc, char *argv[])
 
   flowHelper.SerializeToXmlFile (SystemPath::Append (topo, "flow-monitor.xml"), true, true);
 
+  EnergyAPI::StopServer ();
   Simulator::Destroy ();
 }
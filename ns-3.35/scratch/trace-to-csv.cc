@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <fstream>
+#include "ns3/core-module.h"
+#include "ns3/trace-reader.h"
+
+using namespace ns3;
+
+/*
+ * Convert a binary trace, see BinaryTraceFormat, into the CSV the trace
+ * would have been written as.
+ */
+
+// Bytes formatted per file write
+static const size_t BATCH_SIZE = 1 << 16;
+
+int
+main (int argc, char *argv[])
+{
+  std::string input;
+  std::string output;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("input", "Binary trace to convert", input);
+  cmd.AddValue ("output", "CSV file, the input with a csv extension by default", output);
+  cmd.Parse (argc, argv);
+
+  NS_ABORT_MSG_IF (input.empty (), "No trace to convert, see --input");
+  if (output.empty ())
+    {
+      size_t dot = input.rfind ('.');
+      size_t slash = input.rfind ('/');
+      if (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+        output = input.substr (0, dot);
+      else
+        output = input;
+      output += ".csv";
+    }
+
+  Ptr<TraceReader> reader = Create<TraceReader> (input);
+  Ptr<TraceFormat> csv = TraceFormat::Create ("csv");
+  const TraceSchema &schema = reader->GetSchema ();
+  const std::vector<std::string> &entities = reader->GetEntities ();
+
+  std::ofstream file (output, std::ios::binary | std::ios::trunc);
+  NS_ABORT_MSG_IF (!file, "Cannot write " << output);
+
+  std::string batch;
+  csv->FormatHeader (batch, schema, entities);
+  TraceRow row;
+  while (reader->ReadRow (row))
+    {
+      csv->FormatRow (batch, schema, entities, row);
+      if (batch.size () >= BATCH_SIZE)
+        {
+          file.write (batch.data (), batch.size ());
+          batch.clear ();
+        }
+    }
+  csv->FormatFooter (batch, schema);
+  file.write (batch.data (), batch.size ());
+
+  NS_ABORT_MSG_IF (!file.flush (), "Cannot write " << output);
+  return 0;
+}
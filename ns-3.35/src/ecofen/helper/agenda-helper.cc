@@ -26,6 +26,7 @@
 #include "ns3/names.h"
 #include "ns3/agenda.h"
 #include "ns3/agenda-helper.h"
+#include "ns3/on-off-netdevice-helper.h"
 #include "ns3/loopback-net-device.h"
 
 NS_LOG_COMPONENT_DEFINE ("AgendaHelper");
@@ -81,10 +82,9 @@ AgendaHelper::CreateNodeAgenda (Ptr<Node> node)
       Ptr<NetDevice> netdev = node->GetDevice (i);
       if (netdev->GetInstanceTypeId ().GetName () != "ns3::LoopbackNetDevice")
         {
-          std::vector<double> ag = netdev->GetObject<Agenda> ()->GetTab ();
-          for (uint32_t k = 0; k < ag.size (); k += 2)
+          for (const auto &event : netdev->GetObject<Agenda> ()->GetEvents ())
             {
-              agenda->AddEvent (ag[k], ag[k + 1]);
+              agenda->AddEvent (event.first, event.second);
             }
         }
     }
@@ -101,4 +101,49 @@ AgendaHelper::CreateNodeAgenda (NodeContainer nodec)
     }
 }
 
+void
+AgendaHelper::ScheduleOnOff (Ptr<NetDevice> netdev)
+{
+  NS_ASSERT (netdev != NULL);
+  if (netdev->GetObject<Agenda> () == NULL)
+    {
+      NS_FATAL_ERROR ("Net device agenda not installed!");
+    }
+  Simulator::ScheduleNow (&AgendaHelper::SwitchNext, netdev);
+}
+
+void
+AgendaHelper::ScheduleOnOff (NetDeviceContainer netdevc)
+{
+  for (NetDeviceContainer::Iterator i = netdevc.Begin (); i != netdevc.End (); ++i)
+    {
+      ScheduleOnOff (*i);
+    }
+}
+
+void
+AgendaHelper::SwitchNext (Ptr<NetDevice> netdev)
+{
+  Ptr<Agenda> agenda = netdev->GetObject<Agenda> ();
+  OnOffNetdeviceHelper onOffHelper;
+  double now = Simulator::Now ().GetSeconds ();
+  double start;
+  double stop;
+
+  // No more communication periods
+  if (!agenda->GetNextEvent (now, start, stop))
+    {
+      onOffHelper.NetDeviceSwitchOff (netdev, Simulator::Now ());
+      return;
+    }
+
+  // Only switch off if the device can be back on before the period starts
+  if (start - now > onOffHelper.GetDuration (netdev))
+    {
+      onOffHelper.NetDeviceSwitchOff (netdev, Simulator::Now ());
+      onOffHelper.NetDeviceSwitchOn (netdev, Seconds (start - onOffHelper.GetSwitchOn (netdev)));
+    }
+  Simulator::Schedule (Seconds (stop - now), &AgendaHelper::SwitchNext, netdev);
+}
+
 } // namespace ns3
@@ -62,7 +62,19 @@ public:
 
   void CreateNodeAgenda (NodeContainer nodec);
 
+  /**
+   * Switch a net device off outside the communication periods of its agenda.
+   * The net device needs an OnOffNetdevice. It is switched on early enough to
+   * be ready when a period starts, and gaps shorter than a switch off plus a
+   * switch on are spent on. Only the next switch is scheduled at any time.
+   */
+  void ScheduleOnOff (Ptr<NetDevice> netdev);
+
+  void ScheduleOnOff (NetDeviceContainer netdevc);
+
 private:
+  static void SwitchNext (Ptr<NetDevice> netdev);
+
   ObjectFactory m_ag;
 };
 
@@ -36,7 +36,8 @@ namespace ns3 {
 
 NodeContainer ConsumptionLogger::m_nodes = NodeContainer ();
 NodeContainer ConsumptionLogger::m_nodesLog = NodeContainer ();
-Ptr<OutputStreamWrapper> ConsumptionLogger::m_streamWrapper = NULL;
+Ptr<TraceWriter> ConsumptionLogger::m_writer = NULL;
+std::vector<uint32_t> ConsumptionLogger::m_entities = std::vector<uint32_t> ();
 
 ConsumptionLogger::ConsumptionLogger ()
 {
@@ -64,13 +65,14 @@ ConsumptionLogger::NodeConso (Time interval, Time stop, Ptr<Node> node)
 }
 
 void
-ConsumptionLogger::NodeConsoLog (Time interval, Time stop, Ptr<Node> node, std::string path)
+ConsumptionLogger::NodeConsoLog (Time interval, Time stop, Ptr<Node> node, std::string path,
+                                 std::string format)
 {
   Ptr<NodeEnergyModel> noem = node->GetObject<NodeEnergyModel> ();
   if (noem)
     {
-      CreateLogFile (path);
-      noem->GetConsoLog (interval, stop, node, m_streamWrapper);
+      CreateLogFile (path, format);
+      noem->GetConsoLog (interval, stop, node, m_writer);
     }
 }
 
@@ -116,25 +118,27 @@ ConsumptionLogger::NodeConso (Time interval, Time stop, NodeContainer c)
 void
 ConsumptionLogger::LogEnergy ()
 {
-  for (NodeContainer::Iterator i = m_nodesLog.Begin (); i != m_nodesLog.End (); ++i)
-    (*i)->GetObject<NodeEnergyModel> ()->LogTotalPowerConsumption (*i, m_streamWrapper);
+  for (uint32_t i = 0; i < m_nodesLog.GetN (); i++)
+    m_nodesLog.Get (i)->GetObject<NodeEnergyModel> ()->LogTotalPowerConsumption (m_writer,
+                                                                                  m_entities[i]);
 }
 
 void
-ConsumptionLogger::NodeConsoLog (Time interval, Time stop, NodeContainer c, std::string path)
+ConsumptionLogger::NodeConsoLog (Time interval, Time stop, NodeContainer c, std::string path,
+                                 std::string format)
 {
-  CreateLogFile (path);
+  CreateLogFile (path, format);
   for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
     {
       Ptr<NodeEnergyModel> noem = (*i)->GetObject<NodeEnergyModel> ();
 
       if (noem)
-        m_nodesLog.Add (*i);
+        {
+          m_nodesLog.Add (*i);
+          m_entities.push_back (m_writer->AddEntity (Names::FindName (*i)));
+        }
     }
 
-  std::ostream *stream = m_streamWrapper->GetStream ();
-  *stream << "Time;NodeName;Consumption\n";
-
   Time i = Seconds (0.0);
   while (i <= stop)
     {
@@ -151,10 +155,11 @@ ConsumptionLogger::NodeConso (Time interval, Time stop, std::string nodeName)
 }
 
 void
-ConsumptionLogger::NodeConsoLog (Time interval, Time stop, std::string nodeName, std::string path)
+ConsumptionLogger::NodeConsoLog (Time interval, Time stop, std::string nodeName, std::string path,
+                                 std::string format)
 {
   Ptr<Node> node = Names::Find<Node> (nodeName);
-  NodeConsoLog (interval, stop, NodeContainer (node));
+  NodeConsoLog (interval, stop, NodeContainer (node), path, format);
 }
 
 void
@@ -164,16 +169,24 @@ ConsumptionLogger::NodeConsoAll (Time interval, Time stop)
 }
 
 void
-ConsumptionLogger::NodeConsoAllLog (Time interval, Time stop, std::string path)
+ConsumptionLogger::NodeConsoAllLog (Time interval, Time stop, std::string path,
+                                    std::string format)
+{
+  NodeConsoLog (interval, stop, NodeContainer::GetGlobal (), path, format);
+}
+
+void
+ConsumptionLogger::SetWindow (TraceWindow window)
 {
-  NodeConsoLog (interval, stop, NodeContainer::GetGlobal (), path);
+  NS_ABORT_MSG_IF (!m_writer, "Power consumption is not logged to a file");
+  m_writer->SetWindow (window);
 }
 
 void
-ConsumptionLogger::CreateLogFile (std::string path)
+ConsumptionLogger::CreateLogFile (std::string path, std::string format)
 {
-  if (!m_streamWrapper)
-    m_streamWrapper = Create<OutputStreamWrapper> (path, std::ios::out);
+  if (!m_writer)
+    m_writer = Create<TraceWriter> (path, format, NodeEnergyModel::GetTraceSchema ());
 }
 
 } // namespace ns3
@@ -24,7 +24,7 @@
 #include "ns3/node.h"
 #include "ns3/simulator.h"
 #include "ns3/node-container.h"
-#include "ns3/output-stream-wrapper.h"
+#include "ns3/trace-writer.h"
 
 namespace ns3 {
 
@@ -53,7 +53,7 @@ public:
    */
   void NodeConso (Time interval, Time stop, Ptr<Node> node);
   void NodeConsoLog (Time interval, Time stop, Ptr<Node> node,
-                     std::string path = "ecofen-trace.csv");
+                     std::string path = "ecofen-trace", std::string format = "csv");
 
   /**
    * \param c List of nodes we want to log the power consumption.
@@ -64,7 +64,7 @@ public:
    */
   void NodeConso (Time interval, Time stop, NodeContainer c);
   void NodeConsoLog (Time interval, Time stop, NodeContainer c,
-                     std::string path = "ecofen-trace.csv");
+                     std::string path = "ecofen-trace", std::string format = "csv");
 
   /**
    * \param nodeName Name of node we want to log the power consumption.
@@ -75,7 +75,7 @@ public:
    */
   void NodeConso (Time interval, Time stop, std::string nodeName);
   void NodeConsoLog (Time interval, Time stop, std::string nodeName,
-                     std::string path = "ecofen-trace.csv");
+                     std::string path = "ecofen-trace", std::string format = "csv");
 
   /**
    * \brief This function gets the power consumption of all nodes in simulation.
@@ -86,16 +86,26 @@ public:
    * This function gets the power consumption of all nodes in the simulation. 
    */
   void NodeConsoAll (Time interval, Time stop);
-  void NodeConsoAllLog (Time interval, Time stop, std::string path = "ecofen-trace.csv");
+  void NodeConsoAllLog (Time interval, Time stop, std::string path = "ecofen-trace",
+                        std::string format = "csv");
+
+  /**
+   * \param window The windows to summarize the power consumption over.
+   *
+   * Log the summaries of the power consumption instead of its values, once
+   * the log file is created.
+   */
+  void SetWindow (TraceWindow window);
 
 private:
-  void CreateLogFile (std::string path);
+  void CreateLogFile (std::string path, std::string format);
   void UpdateEnergy ();
   void LogEnergy ();
 
-  static Ptr<OutputStreamWrapper> m_streamWrapper;
+  static Ptr<TraceWriter> m_writer;
   static NodeContainer m_nodes;
   static NodeContainer m_nodesLog;
+  static std::vector<uint32_t> m_entities; //!< Trace entity of each logged node
 };
 
 } // namespace ns3
@@ -26,7 +26,7 @@
 
 namespace ns3 {
 
-DataRateNetdeviceEnergyHelper::DataRateNetdeviceEnergyHelper ()
+DataRateNetdeviceEnergyHelper::DataRateNetdeviceEnergyHelper () : m_lpiConso (0.0)
 {
   m_dataRateNetdeviceEnergyModel.SetTypeId ("ns3::DataRateNetdeviceEnergyModel");
 }
@@ -47,6 +47,18 @@ DataRateNetdeviceEnergyHelper::SetConsumptionValues (std::map<uint64_t, double>
   m_values = values;
 }
 
+void
+DataRateNetdeviceEnergyHelper::SetLpiConsumption (double conso)
+{
+  m_lpiConso = conso;
+}
+
+bool
+DataRateNetdeviceEnergyHelper::HasDataRate (uint64_t bps) const
+{
+  return m_values.find (bps) != m_values.end ();
+}
+
 Ptr<NetdeviceEnergyModel>
 DataRateNetdeviceEnergyHelper::DoInstall (Ptr<NetDevice> netdevice) const
 {
@@ -63,6 +75,7 @@ DataRateNetdeviceEnergyHelper::DoInstall (Ptr<NetDevice> netdevice) const
   energy->SetNetdevice (netdevice);
   energy->SetUnit (m_unit);
   energy->SetConsumptionValues (m_values);
+  energy->SetLpiConsumption (m_lpiConso);
   netdevice->AggregateObject (energy);
   energy->Initialize ();
   return energy;
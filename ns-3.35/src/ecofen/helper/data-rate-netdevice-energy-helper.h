@@ -37,6 +37,12 @@ public:
 
   void SetUnit (uint64_t bps);
   void SetConsumptionValues (std::map<uint64_t, double> values);
+  void SetLpiConsumption (double conso);
+
+  /**
+   * \returns true if the model has a consumption value for the data rate.
+   */
+  bool HasDataRate (uint64_t bps) const;
 
 private:
   virtual Ptr<NetdeviceEnergyModel> DoInstall (Ptr<NetDevice> netdevice) const;
@@ -45,6 +51,7 @@ private:
   ObjectFactory m_dataRateNetdeviceEnergyModel;
   uint64_t m_unit;
   std::map<uint64_t, double> m_values;
+  double m_lpiConso;
 };
 
 } // namespace ns3
@@ -23,6 +23,8 @@
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 namespace ns3 {
@@ -60,120 +62,89 @@ Agenda::GetNetdev (void) const
 void
 Agenda::AddEvent (double start, double stop)
 {
-  if (m_agenda.size () == 0)
-    {
-      m_agenda.push_back (start);
-      m_agenda.push_back (stop);
-    }
-  else
+  NS_ASSERT_MSG (start <= stop, "Agenda period ends before it starts");
+
+  // Merge with the period starting before, if it reaches start
+  std::map<double, double>::iterator it = m_agenda.upper_bound (start);
+  if (it != m_agenda.begin ())
     {
-      uint32_t i = 0;
-      uint32_t j = 0;
-      while ((start > m_agenda[i]) && (i < m_agenda.size ()))
-        {
-          i++;
-        }
-      while ((stop > m_agenda[j]) && (j < m_agenda.size ()))
-        {
-          j++;
-        }
-      // if start is after all the agenda's dates
-      if (i == m_agenda.size ())
-        {
-          m_agenda.push_back (start);
-          m_agenda.push_back (stop);
-        }
-      // if stop is before all the agenda's dates
-      else if (j == 0)
-        {
-          // if stop is equal to the first date
-          if (m_agenda[0] == stop)
-            {
-              m_agenda[0] = start;
-            }
-          // otherwise
-          else
-            {
-              std::vector<double>::iterator it;
-              it = m_agenda.begin ();
-              m_agenda.insert (it, stop);
-              it = m_agenda.begin ();
-              m_agenda.insert (it, start);
-            }
-        }
-      // if there is no date between start and stop
-      else if (i == j)
+      std::map<double, double>::iterator prev = std::prev (it);
+      if (prev->second >= start)
         {
-          // if i is a starting date
-          if (i % 2 == 0)
-            {
-              std::vector<double>::iterator it;
-              it = m_agenda.begin ();
-              m_agenda.insert (it + i, start);
-              // if stop is already an agenda's date
-              if (stop == m_agenda[j])
-                {
-                  it = m_agenda.begin ();
-                  m_agenda.erase (it + i + 1); //position i+1
-                }
-              // if stop is not an agenda's date
-              else
-                {
-                  it = m_agenda.begin ();
-                  m_agenda.insert (it + i + 1, stop);
-                }
-            }
-          // if i is an ending date, nothing to do
-        }
-      else // i!= j
-        {
-          std::vector<double>::iterator it;
-          uint32_t size = m_agenda.size ();
-          double agj;
-          uint32_t z = 0;
-          if (j != size)
-            {
-              agj = m_agenda[j];
-            }
-          it = m_agenda.begin ();
-          m_agenda.erase (it + i, it + j); // erase [i, j[
-          // if i is a starting date
-          if (i % 2 == 0)
-            {
-              it = m_agenda.begin ();
-              m_agenda.insert (it + i, start);
-              z++;
-            }
-          // else -> nothing to do
-          // if j is a starting date
-          if (j % 2 == 0)
-            {
-              // if stop is already an agenda's date
-              if (j == size)
-                {
-                  m_agenda.push_back (stop);
-                }
-              else if (stop == agj)
-                {
-                  it = m_agenda.begin ();
-                  m_agenda.erase (it + i + z); //position i
-                }
-              // if stop is not an agenda's date
-              else
-                {
-                  it = m_agenda.begin ();
-                  m_agenda.insert (it + i + z, stop);
-                }
-            }
-          // else -> nothing to do
+          start = prev->first;
+          it = prev;
         }
     }
+  // Absorb every period starting before stop
+  while (it != m_agenda.end () && it->first <= stop)
+    {
+      stop = std::max (stop, it->second);
+      it = m_agenda.erase (it);
+    }
+  m_agenda.emplace_hint (it, start, stop);
+}
+
+bool
+Agenda::IsActive (double date) const
+{
+  std::map<double, double>::const_iterator it = m_agenda.upper_bound (date);
+  if (it == m_agenda.begin ())
+    {
+      return false;
+    }
+  return std::prev (it)->second >= date;
+}
+
+bool
+Agenda::GetNextEvent (double date, double &start, double &stop) const
+{
+  std::map<double, double>::const_iterator it = m_agenda.upper_bound (date);
+  if (it != m_agenda.begin () && std::prev (it)->second > date)
+    {
+      it = std::prev (it);
+    }
+  if (it == m_agenda.end ())
+    {
+      return false;
+    }
+  start = it->first;
+  stop = it->second;
+  return true;
+}
+
+std::vector<std::pair<double, double>>
+Agenda::GetEvents (double from, double to) const
+{
+  std::vector<std::pair<double, double>> events;
+  std::map<double, double>::const_iterator it = m_agenda.upper_bound (from);
+  if (it != m_agenda.begin () && std::prev (it)->second >= from)
+    {
+      it = std::prev (it);
+    }
+  for (; it != m_agenda.end () && it->first <= to; ++it)
+    {
+      events.push_back (*it);
+    }
+  return events;
+}
+
+const std::map<double, double> &
+Agenda::GetEvents (void) const
+{
+  return m_agenda;
 }
 
 std::vector<double>
 Agenda::GetTab () const
 {
-  return m_agenda;
+  std::vector<double> tab;
+  tab.reserve (m_agenda.size () * 2);
+  for (const auto &event : m_agenda)
+    {
+      tab.push_back (event.first);
+      tab.push_back (event.second);
+    }
+  return tab;
 }
 
 } // namespace ns3
@@ -27,6 +27,7 @@
 #include "ns3/net-device.h"
 #include "ns3/node.h"
 #include "ns3/nstime.h"
+#include <map>
 #include <vector>
 #include "ns3/net-device-container.h"
 #include "ns3/node-container.h"
@@ -37,6 +38,10 @@ namespace ns3 {
 /**
  * \ingroup energy
  * \brief Base class for net devices agendas.
+ *
+ * The communication periods are kept as a balanced tree of disjoint
+ * [start, stop] intervals keyed by their start date, so inserting, merging
+ * and looking up a period are O(log n).
  */
 
 class Agenda : public Object
@@ -63,17 +68,46 @@ public:
 
   /**
    * Add a commnication period into the agenda.
+   * Overlapping or adjacent periods are merged.
    *
    */
   void AddEvent (double start, double stop);
 
+  /**
+   * \param date Date in seconds.
+   *
+   * \returns True if date falls inside a communication period.
+   */
+  bool IsActive (double date) const;
+
+  /**
+   * Find the first communication period ending after a date.
+   *
+   * \param date Date in seconds.
+   * \param start Start of the period found.
+   * \param stop End of the period found.
+   *
+   * \returns False if there is no such period.
+   */
+  bool GetNextEvent (double date, double &start, double &stop) const;
+
+  /**
+   * \returns The communication periods overlapping [from, to].
+   */
+  std::vector<std::pair<double, double>> GetEvents (double from, double to) const;
+
+  /**
+   * \returns All the communication periods, ordered by start date.
+   */
+  const std::map<double, double> &GetEvents (void) const;
+
   /**
    * Get the vector containing the dates.
    */
   std::vector<double> GetTab (void) const;
 
-public:
-  std::vector<double> m_agenda;
+private:
+  std::map<double, double> m_agenda;
   Ptr<NetDevice> m_netdev;
 };
 
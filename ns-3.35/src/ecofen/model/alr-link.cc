@@ -18,49 +18,42 @@
  * Author: Anne-Cecile Orgerie <anne-cecile.orgerie@irisa.fr>
  */
 
-#include "node-energy-model.h"
+#include <algorithm>
 #include "alr-link.h"
 #include "ns3/uinteger.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
-#include "ns3/ipv4.h"
-#include "ns3/ipv6.h"
-#include "ns3/node.h"
+#include "ns3/queue.h"
 #include "ns3/netdevice-energy-model.h"
-#include "ns3/basic-netdevice-energy-model.h"
-#include "ns3/linear-netdevice-energy-model.h"
-#include "ns3/complete-netdevice-energy-model.h"
 
 namespace ns3 {
 
+NS_LOG_COMPONENT_DEFINE ("AlrLink");
+
 NS_OBJECT_ENSURE_REGISTERED (AlrLink);
 
 TypeId
 AlrLink::GetTypeId (void)
 {
-  static TypeId tid = TypeId ("ns3::AlrLink").SetParent<Object> ().AddConstructor<AlrLink> ()
-      /*.AddAttribute ("FullyOnState","The state number of",
-                   DoubleValue (),
-                   MakeDoubleAccessor (&AlrLink::m_switchOnEnergy),
-                   MakeDoubleChecker<double> ())
-    .AddAttribute ("SwitchOffEnergy","The energy used to switch off a node.",
-                   DoubleValue (),
-                   MakeDoubleAccessor (&AlrLink::m_switchOffEnergy),
-                   MakeDoubleChecker<double> ())
-    .AddAttribute ("SwitchOffDuration","The duration of a switch off a node in seconds.",
-                   DoubleValue (),
-                   MakeDoubleAccessor (&AlrLink::m_switchOffDuration),
-                   MakeDoubleChecker<double> ())
-    .AddAttribute ("SwitchOnDuration","The duration of a switch on a node in seconds.",
-                   DoubleValue (),
-                   MakeDoubleAccessor (&AlrLink::m_switchOnDuration),
-                   MakeDoubleChecker<double> ())*/
-      ;
+  static TypeId tid =
+      TypeId ("ns3::AlrLink")
+          .SetParent<Object> ()
+          .AddConstructor<AlrLink> ()
+          .AddAttribute ("SwitchTime", "The duration of a rate change, transmissions are held.",
+                         TimeValue (MilliSeconds (1)), MakeTimeAccessor (&AlrLink::m_switchTime),
+                         MakeTimeChecker ())
+          .AddAttribute ("SwitchEnergy", "The energy used by a net device to change its rate.",
+                         DoubleValue (0.0), MakeDoubleAccessor (&AlrLink::m_switchEnergy),
+                         MakeDoubleChecker<double> ())
+          .AddAttribute ("HighThreshold",
+                         "The number of queued packets from which the rate is increased.",
+                         UintegerValue (10), MakeUintegerAccessor (&AlrLink::m_highThreshold),
+                         MakeUintegerChecker<uint32_t> ());
   return tid;
 }
 
-AlrLink::AlrLink ()
+AlrLink::AlrLink () : m_lastChange (Time::Min ()), m_rate (0)
 {
 }
 
@@ -68,12 +61,38 @@ AlrLink::~AlrLink ()
 {
 }
 
+void
+AlrLink::DoDispose (void)
+{
+  m_evaluateEvent.Cancel ();
+  m_link = NetDeviceContainer ();
+  m_netdevs[0] = 0;
+  m_netdevs[1] = 0;
+  Object::DoDispose ();
+}
+
 void
 AlrLink::SetLink (NetDeviceContainer link)
 {
-  NS_ASSERT (link != NULL);
-  //TODO vérifier qu'il n'y a bien que 2 net devices
+  if (link.GetN () != 2)
+    {
+      NS_FATAL_ERROR ("You did not apply ALR to a link!");
+    }
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      m_netdevs[i] = DynamicCast<PointToPointEthernetNetDevice> (link.Get (i));
+      NS_ABORT_MSG_IF (m_netdevs[i] == 0, "ALR requires PointToPointEthernetNetDevice links");
+      m_netdevs[i]->TraceConnectWithoutContext ("MacTx",
+                                                MakeCallback (&AlrLink::NotifyTxRequest, this));
+      m_netdevs[i]->TraceConnectWithoutContext ("TxQueueEmpty",
+                                                MakeCallback (&AlrLink::NotifyTxIdle, this));
+    }
   m_link = link;
+  m_rates.assign (1, m_netdevs[0]->GetDataRate ());
+  m_rate = 0;
+
+  // A link carrying no traffic steps down from the start
+  m_evaluateEvent = Simulator::ScheduleNow (&AlrLink::Evaluate, this);
 }
 
 NetDeviceContainer
@@ -83,39 +102,116 @@ AlrLink::GetLink (void) const
 }
 
 void
-AlrLink::DeclareRates (std::vector<uint32_t> rates)
+AlrLink::DeclareRates (std::vector<DataRate> rates)
 {
-  uint32_t i;
-  sort (rates.begin (), rates.end ());
-  for (i = 0; i < rates.size (); i++)
-    {
-      m_rates.push_back (rates[i]);
-    }
-  sort (m_rates.begin (), m_rates.end ());
+  NS_ASSERT_MSG (m_netdevs[0] != 0, "SetLink must be called before DeclareRates");
+  DataRate current = m_rates[m_rate];
+  rates.push_back (current);
+  std::sort (rates.begin (), rates.end ());
+  rates.erase (std::unique (rates.begin (), rates.end ()), rates.end ());
+  m_rates = rates;
+  m_rate = std::lower_bound (m_rates.begin (), m_rates.end (), current) - m_rates.begin ();
 }
 
 void
-AlrLink::ChangeState (uint32_t rate)
+AlrLink::ChangeState (DataRate rate)
 {
-  for (NetDeviceContainer::Iterator i = m_link.Begin (); i != m_link.End (); ++i)
+  std::vector<DataRate>::iterator it = std::lower_bound (m_rates.begin (), m_rates.end (), rate);
+  NS_ABORT_MSG_IF (it == m_rates.end () || *it != rate, "Rate " << rate << " was not declared");
+  uint32_t index = it - m_rates.begin ();
+  if (index == m_rate)
+    {
+      return;
+    }
+  NS_LOG_LOGIC ("Link " << m_netdevs[0] << "-" << m_netdevs[1] << " switches from "
+                        << m_rates[m_rate] << " to " << rate);
+  m_rate = index;
+  m_lastChange = Simulator::Now ();
+  for (uint32_t i = 0; i < 2; i++)
     {
-      //TODO TODO NetDeviceSwitchOff (*i, date);
+      m_netdevs[i]->SetDataRate (rate);
+      m_netdevs[i]->HoldTransmissions (m_lastChange + m_switchTime);
+
+      // Closes the period at the previous rate
+      Ptr<NetdeviceEnergyModel> ndem = m_netdevs[i]->GetObject<NetdeviceEnergyModel> ();
+      if (ndem != 0)
+        {
+          ndem->UpdateState (ndem->GetNetdeviceOnState (), m_switchEnergy, m_switchTime);
+        }
     }
+  m_evaluateEvent.Cancel ();
+  m_evaluateEvent = Simulator::Schedule (m_switchTime, &AlrLink::Evaluate, this);
 }
 
 void
 AlrLink::DecreaseSpeed (void)
 {
+  if (m_rate > 0)
+    {
+      ChangeState (m_rates[m_rate - 1]);
+    }
 }
 
 void
 AlrLink::IncreaseSpeed (void)
 {
+  if (m_rate + 1 < m_rates.size ())
+    {
+      ChangeState (m_rates[m_rate + 1]);
+    }
+}
+
+void
+AlrLink::Evaluate (void)
+{
+  if (IsSwitching ())
+    {
+      return;
+    }
+  if (m_netdevs[0]->GetQueue ()->GetNPackets () >= m_highThreshold ||
+      m_netdevs[1]->GetQueue ()->GetNPackets () >= m_highThreshold)
+    {
+      IncreaseSpeed ();
+    }
+  else if (m_netdevs[0]->IsTxIdle () && m_netdevs[1]->IsTxIdle ())
+    {
+      DecreaseSpeed ();
+    }
+}
+
+bool
+AlrLink::IsSwitching (void) const
+{
+  return Simulator::Now () < m_lastChange + m_switchTime;
+}
+
+void
+AlrLink::NotifyTxRequest (Ptr<const Packet> packet)
+{
+  if (IsSwitching ())
+    {
+      return;
+    }
+  // MacTx fires before the packet is enqueued, so a queue holding
+  // HighThreshold - 1 packets reaches the threshold with this one
+  if (m_netdevs[0]->GetQueue ()->GetNPackets () + 1 >= m_highThreshold ||
+      m_netdevs[1]->GetQueue ()->GetNPackets () + 1 >= m_highThreshold)
+    {
+      IncreaseSpeed ();
+    }
 }
 
 void
-AlrLink::Watch (void)
+AlrLink::NotifyTxIdle (void)
 {
+  if (IsSwitching ())
+    {
+      return;
+    }
+  if (m_netdevs[0]->IsTxIdle () && m_netdevs[1]->IsTxIdle ())
+    {
+      DecreaseSpeed ();
+    }
 }
 
 } // namespace ns3
@@ -21,98 +21,99 @@
 #ifndef ALR_LINK_H
 #define ALR_LINK_H
 
+#include <vector>
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/type-id.h"
-#include "ns3/net-device.h"
+#include "ns3/packet.h"
 #include "ns3/nstime.h"
-#include <vector>
-#include "ns3/object-vector.h"
+#include "ns3/event-id.h"
+#include "ns3/data-rate.h"
 #include "ns3/net-device-container.h"
+#include "ns3/point-to-point-ethernet-net-device.h"
 
 namespace ns3 {
 
 /**
  * \ingroup energy
- * \brief Base class for ALR functions on links.
+ * \brief Adaptive Link Rate on a point to point Ethernet link.
+ *
+ * Dual threshold policy driven by the events of the two net devices: the
+ * link steps up to the next declared rate once a queue holds HighThreshold
+ * packets, and steps down once both transmitters are idle. Transmissions are
+ * held while the link changes its rate, the link is evaluated again once the
+ * change is done, so an idle link keeps stepping down to its lowest rate. The
+ * energy of each rate is given by the net device energy model (e.g. the
+ * dataRate interface model), each change closing the period at the previous
+ * rate and switching for SwitchTime with SwitchEnergy.
  */
-
 class AlrLink : public Object
 {
 public:
   static TypeId GetTypeId (void);
   AlrLink ();
   virtual ~AlrLink ();
-
   /**
-   * \brief Sets pointer to netdevices containing this AlrLink.
+   * \brief Sets the net devices of the link and hooks their transmit events.
    *
-   * \param link Pointer to the link containing this AlrLink.
+   * \param link The two PointToPointEthernetNetDevice of the link.
    */
   void SetLink (NetDeviceContainer link);
-
   /**
-   * \returns Pointer to link containing this AlrLink.
-   *
-   * When a subclass needs to get access to the underlying link base class to
-   * print the NetDeviceId for example, it can invoke this method.
+   * \returns The net devices of the link.
    */
   NetDeviceContainer GetLink (void) const;
-
   /**
-   * To declare the different available transmission rates in Mbps.
-   * Warning: declare also the maximum rate (= bandwidth) and do not declare 0.
+   * To declare the different available transmission rates.
+   * The current rate of the link is always available.
    */
-  void DeclareRates (std::vector<uint32_t> rates);
-
-  /**
-   * To add the energy values for a rate on a net device.
-   * The number of energy values depends on the net device energy model.
-   */
-  void AddRateConso (uint32_t netdevnb, uint32_t rate, double conso);
-  void AddRateConso (uint32_t netdevnb, uint32_t rate, double conso, double conso);
-  void AddRateConso (uint32_t netdevnb, uint32_t rate, double conso, double conso, double conso,
-                     double conso, double conso);
-
+  void DeclareRates (std::vector<DataRate> rates);
   /**
-   *
-   * To change the state of a link and state the new rate.
+   * To change the rate of the link. Nothing is done if the link already
+   * runs at this rate.
    *
    * \param rate Value of the new rate of the link.
    */
-  void ChangeState (uint32_t rate);
-
+  void ChangeState (DataRate rate);
   /**
-   *
    * To decrease the rate of a link.
-   *
    */
   void DecreaseSpeed (void);
-
   /**
    * To increase the rate of a link.
-   *
    */
   void IncreaseSpeed (void);
 
+protected:
+  virtual void DoDispose (void);
+
+private:
   /**
-   * To have automatic ALR function.
-   *
+   * A packet is being sent by one of the net devices.
+   */
+  void NotifyTxRequest (Ptr<const Packet> packet);
+  /**
+   * One of the net devices went idle with an empty queue.
+   */
+  void NotifyTxIdle (void);
+  /**
+   * Step up or down according to the current queues of the net devices.
    */
-  void Watch (void);
+  void Evaluate (void);
+  /**
+   * \returns true while the link is changing its rate.
+   */
+  bool IsSwitching (void) const;
 
-private:
   NetDeviceContainer m_link;
-
+  Ptr<PointToPointEthernetNetDevice> m_netdevs[2];
   Time m_lastChange;
-  std::vector<uint32_t> m_stateNbNetdev1;
-  std::vector<uint32_t> m_stateNbNetdev2;
-  std::vector<uint32_t> m_rates;
-  //std::vector<double> m_consosNetdev1;
-  //std::vector<double> m_consosNetdev2;
-  std::vector<std::vector<double>> m_changeTimes;
-  std::vector<std::vector<double>> m_changeEnergysNetdev1;
-  std::vector<std::vector<double>> m_changeEnergysNetdev2;
+  Time m_switchTime;
+  double m_switchEnergy;
+  EventId m_evaluateEvent;
+  uint32_t m_highThreshold;
+  std::vector<DataRate> m_rates;
+  uint32_t m_rate; //!< Index of the current rate in m_rates
 };
 
 } // namespace ns3
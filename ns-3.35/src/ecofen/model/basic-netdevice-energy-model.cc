@@ -50,9 +50,7 @@ BasicNetdeviceEnergyModel::GetTypeId (void)
 
 BasicNetdeviceEnergyModel::BasicNetdeviceEnergyModel ()
 {
-  m_lastUpdateTime = Seconds (0.0);
-  m_stateTab.push_back (GetNetdeviceState ());
-  m_timeTab.push_back (Seconds (0.0));
+  m_timeline.Reset (GetNetdeviceState ());
 }
 
 BasicNetdeviceEnergyModel::~BasicNetdeviceEnergyModel ()
@@ -107,144 +105,40 @@ BasicNetdeviceEnergyModel::AddState (double conso)
 double
 BasicNetdeviceEnergyModel::GetPowerConsumption (void)
 {
-  double totconso = 0.0;
-  Time now = Simulator::Now ();
-  Time firsttime = m_timeTab.front ();
-  bool end = false;
-  double conso = 0.0;
-  while (!end)
-    {
-      // Set the parameters of the period.
-      uint32_t state = m_stateTab.front ();
-      Time first = m_timeTab.front ();
-      Time last;
-      Time duration;
-      // Determine the duration of the period.
-      if (first < m_lastUpdateTime)
-        {
-          first = m_lastUpdateTime;
-        }
-      if (m_stateTab.size () > 1)
-        {
-          last = m_timeTab.at (1);
-          if (last > now)
-            {
-              last = now;
-            }
-        }
-      else
-        {
-          last = now;
-        }
-      duration = last - first;
-      // Determine the energy consumption of the period.
-      if (duration != Seconds (0.0))
-        {
-          switch (state)
-            {
-            case 0:
-              conso += m_offConso * duration.GetSeconds ();
-              break;
-            case 1:
-              conso += m_onConso * duration.GetSeconds ();
-              break;
-              case 2: {
-                Time switchduration = m_timeTab.at (1) - m_timeTab.front ();
-                conso += (m_switchEnergyTab.front () * duration.GetSeconds () /
-                          switchduration.GetSeconds ());
-                break;
-              }
-            default:
-              conso += m_stateConso.at (state) * duration.GetSeconds ();
-            }
-        }
-      else if (now == Seconds (0.0))
-        {
-          switch (state)
-            {
-            case 0:
-              totconso = m_offConso;
-              break;
-            case 1:
-              totconso = m_onConso;
-              break;
-              case 2: {
-                Time switchduration = m_timeTab.at (1) - m_timeTab.front ();
-                totconso = (m_switchEnergyTab.front () / switchduration.GetSeconds ());
-                break;
-              }
-            default:
-              totconso = m_stateConso.at (state);
-            }
-        }
-      // Go to the next period.
-      if (last == now)
-        {
-          end = true;
-        }
-      else
-        {
-          if (state == 2)
-            {
-              m_switchEnergyTab.erase (m_switchEnergyTab.begin ());
-            }
-          m_timeTab.erase (m_timeTab.begin ());
-          m_stateTab.erase (m_stateTab.begin ());
-        }
-    }
-  // Compute the total power consumption;
-  if (firsttime != now)
+  return m_timeline.GetAveragePower (
+      MakeCallback (&BasicNetdeviceEnergyModel::GetPeriodEnergy, this),
+      MakeCallback (&BasicNetdeviceEnergyModel::GetStatePower, this));
+}
+
+double
+BasicNetdeviceEnergyModel::GetStatePower (uint32_t state)
+{
+  switch (state)
     {
-      Time tottime = now - m_lastUpdateTime;
-      totconso = conso / tottime.GetSeconds ();
+    case 0:
+      return m_offConso;
+    case 1:
+      return m_onConso;
+    default:
+      return m_stateConso.at (state);
     }
-  m_lastUpdateTime = now;
-  return totconso;
+}
+
+double
+BasicNetdeviceEnergyModel::GetPeriodEnergy (const StateTimeline::Period &period, double seconds,
+                                            bool ongoing)
+{
+  return GetStatePower (period.state) * seconds;
 }
 
 void
 BasicNetdeviceEnergyModel::UpdateState (uint32_t state, double energy, Time duration)
 {
   // We do not switch on/off a device which is already on/off.
-  //NS_LOG_UNCOND ("Tutu " << state << " " << energy << " " << duration.GetSeconds ());
-  if (state != m_stateTab.back ())
+  if (state != m_timeline.GetLastState ())
     {
-      if (duration != Seconds (0.0))
-        {
-          // Add the switch
-          if ((m_timeTab.back () == Simulator::Now () && (Simulator::Now () != Seconds (0.0))))
-            {
-              m_stateTab.pop_back ();
-              m_stateTab.push_back (2);
-              m_switchEnergyTab.push_back (energy);
-            }
-          else
-            {
-              m_stateTab.push_back (2);
-              m_timeTab.push_back (Simulator::Now ());
-              m_switchEnergyTab.push_back (energy);
-            }
-        }
-      // Add the next state
-      if ((m_timeTab.back () == Simulator::Now () + duration) &&
-          (Simulator::Now () + duration != Seconds (0.0)))
-        {
-          m_stateTab.pop_back ();
-          m_stateTab.push_back (state);
-        }
-
-      else
-        {
-          m_stateTab.push_back (state);
-          m_timeTab.push_back (Simulator::Now () + duration);
-        }
+      m_timeline.Update (state, energy, duration);
     }
-  /*uint32_t k;
-  NS_LOG_UNCOND ("Ttable ");
-  for (k = 0; k < m_stateTab.size (); k++)
-    {
-      NS_LOG_UNCOND (" " << m_timeTab.at (k).GetSeconds ());
-    }*/
 }
 
 } // namespace ns3
@@ -23,6 +23,7 @@
 
 #include <vector>
 #include "netdevice-energy-model.h"
+#include "state-timeline.h"
 #include "ns3/nstime.h"
 #include "ns3/traced-value.h"
 #include "ns3/object-vector.h"
@@ -108,17 +109,25 @@ public:
    */
   virtual void UpdateState (uint32_t state, double energy, Time duration);
 
+private:
+  /**
+   * \returns Power consumption (in Watts) of a state.
+   */
+  double GetStatePower (uint32_t state);
+
+  /**
+   * \returns Energy consumed (in Joules) during a period of the timeline.
+   */
+  double GetPeriodEnergy (const StateTimeline::Period &period, double seconds, bool ongoing);
+
 private:
   std::vector<double> m_stateConso;
   double m_offConso;
   double m_onConso;
 
-  Time m_lastUpdateTime;
   Ptr<NetDevice> m_netdevice;
 
-  std::vector<uint32_t> m_stateTab;
-  std::vector<Time> m_timeTab;
-  std::vector<double> m_switchEnergyTab;
+  StateTimeline m_timeline;
 };
 
 } // namespace ns3
@@ -44,9 +44,7 @@ BasicNodeEnergyModel::GetTypeId (void)
 
 BasicNodeEnergyModel::BasicNodeEnergyModel ()
 {
-  m_lastUpdateTime = Seconds (0.0);
-  m_stateTab.push_back (GetNodeState ());
-  m_timeTab.push_back (Seconds (0.0));
+  m_timeline.Reset (GetNodeState ());
 }
 
 BasicNodeEnergyModel::~BasicNodeEnergyModel ()
@@ -101,133 +99,35 @@ BasicNodeEnergyModel::AddState (double conso)
 double
 BasicNodeEnergyModel::GetPowerConsumption (void)
 {
-  //TODO: peut-être implémentation à changer pour une plus grande modularité
-  double totconso = 0.0;
-  Time now = Simulator::Now ();
-  Time firsttime = m_timeTab.front ();
-  bool end = false;
-  double conso = 0.0;
-  while (!end)
-    {
-      // Set the parameters of the period.
-      uint32_t state = m_stateTab.front ();
-      Time first = m_timeTab.front ();
-      Time last;
-      Time duration;
-      // Determine the duration of the period.
-      if (first < m_lastUpdateTime)
-        {
-          first = m_lastUpdateTime;
-        }
-      if (m_stateTab.size () > 1)
-        {
-          last = m_timeTab.at (1);
-          if (last > now)
-            {
-              last = now;
-            }
-        }
-      else
-        {
-          last = now;
-        }
-      duration = last - first;
-      // Determine the energy consumption of the period.
-      if (duration != Seconds (0.0))
-        {
-          switch (state)
-            {
-            case 0:
-              conso += m_offConso * duration.GetSeconds ();
-              break;
-            case 1:
-              conso += m_onConso * duration.GetSeconds ();
-              break;
-              case 2: {
-                Time switchduration = m_timeTab.at (1) - m_timeTab.front ();
-                conso += (m_switchEnergyTab.front () * duration.GetSeconds () /
-                          switchduration.GetSeconds ());
-                break;
-              }
-            default:
-              conso += m_stateConso.at (state) * duration.GetSeconds ();
-            }
-        }
-      else if (now == Seconds (0.0))
-        {
-          switch (state)
-            {
-            case 0:
-              totconso = m_offConso;
-              break;
-            case 1:
-              totconso = m_onConso;
-              break;
-              case 2: {
-                Time switchduration = m_timeTab.at (1) - m_timeTab.front ();
-                totconso = (m_switchEnergyTab.front () / switchduration.GetSeconds ());
-                break;
-              }
-            default:
-              totconso = m_stateConso.at (state);
-            }
-        }
-      // Go to the next period.
-      if (last == now)
-        {
-          end = true;
-        }
-      else
-        {
-          if (state == 2)
-            {
-              m_switchEnergyTab.erase (m_switchEnergyTab.begin ());
-            }
-          m_timeTab.erase (m_timeTab.begin ());
-          m_stateTab.erase (m_stateTab.begin ());
-        }
-    }
-  // Compute the total power consumption;
-  if (firsttime != now)
+  return m_timeline.GetAveragePower (MakeCallback (&BasicNodeEnergyModel::GetPeriodEnergy, this),
+                                     MakeCallback (&BasicNodeEnergyModel::GetStatePower, this));
+}
+
+double
+BasicNodeEnergyModel::GetStatePower (uint32_t state)
+{
+  switch (state)
     {
-      Time tottime = now - m_lastUpdateTime;
-      totconso = conso / tottime.GetSeconds ();
+    case 0:
+      return m_offConso;
+    case 1:
+      return m_onConso;
+    default:
+      return m_stateConso.at (state);
     }
-  m_lastUpdateTime = now;
-  return totconso;
+}
+
+double
+BasicNodeEnergyModel::GetPeriodEnergy (const StateTimeline::Period &period, double seconds,
+                                       bool ongoing)
+{
+  return GetStatePower (period.state) * seconds;
 }
 
 void
 BasicNodeEnergyModel::UpdateState (uint32_t state, double energy, Time duration)
 {
-  if (duration != Seconds (0.0))
-    {
-      // Add the switch
-      if ((m_timeTab.back () == Simulator::Now () && (Simulator::Now () != Seconds (0.0))))
-        {
-          m_stateTab.pop_back ();
-          m_stateTab.push_back (2);
-          m_switchEnergyTab.push_back (energy);
-        }
-      else
-        {
-          m_stateTab.push_back (2);
-          m_timeTab.push_back (Simulator::Now ());
-          m_switchEnergyTab.push_back (energy);
-        }
-    }
-  // Add the next state
-  if ((m_timeTab.back () == Simulator::Now () + duration) &&
-      (Simulator::Now () + duration != Seconds (0.0)))
-    {
-      m_stateTab.pop_back ();
-      m_stateTab.push_back (state);
-    }
-  else
-    {
-      m_stateTab.push_back (state);
-      m_timeTab.push_back (Simulator::Now () + duration);
-    }
+  m_timeline.Update (state, energy, duration);
 }
 
 } // namespace ns3
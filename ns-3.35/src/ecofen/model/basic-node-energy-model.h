@@ -22,6 +22,7 @@
 #define BASIC_NODE_ENERGY_MODEL_H_
 
 #include "node-energy-model.h"
+#include "state-timeline.h"
 #include "ns3/nstime.h"
 #include "ns3/traced-value.h"
 
@@ -107,17 +108,24 @@ private:
    */
   virtual double GetPowerConsumption (void);
 
+  /**
+   * \returns Power consumption (in Watts) of a state.
+   */
+  double GetStatePower (uint32_t state);
+
+  /**
+   * \returns Energy consumed (in Joules) during a period of the timeline.
+   */
+  double GetPeriodEnergy (const StateTimeline::Period &period, double seconds, bool ongoing);
+
 private:
   double m_onConso;
   double m_offConso;
-  Time m_lastUpdateTime;
   Ptr<Node> m_node;
   //double m_totalEnergyConsumption;
 
   std::vector<double> m_stateConso;
-  std::vector<uint32_t> m_stateTab;
-  std::vector<Time> m_timeTab;
-  std::vector<double> m_switchEnergyTab;
+  StateTimeline m_timeline;
 };
 
 } // namespace ns3
@@ -80,11 +80,9 @@ CompleteNetdeviceEnergyModel::GetTypeId (void)
 
 CompleteNetdeviceEnergyModel::CompleteNetdeviceEnergyModel ()
 {
-  m_lastUpdateTime = Seconds (0.0);
   m_slastPos = 0;
   m_rlastPos = 0;
-  m_stateTab.push_back (GetNetdeviceState ());
-  m_timeTab.push_back (Seconds (0.0));
+  m_timeline.Reset (GetNetdeviceState ());
 }
 
 CompleteNetdeviceEnergyModel::~CompleteNetdeviceEnergyModel ()
@@ -276,191 +274,65 @@ CompleteNetdeviceEnergyModel::GetNbRecv (void)
 double
 CompleteNetdeviceEnergyModel::GetPowerConsumption (void)
 {
-  double totconso = 0.0;
-  Time now = Simulator::Now ();
-  Time firsttime = m_timeTab.front ();
-  bool end = false;
-  double conso = 0.0;
-  while (!end)
-    {
-      // Set the parameters of the period.
-      uint32_t state = m_stateTab.front ();
-      Time first = m_timeTab.front ();
-      Time last;
-      Time duration;
-      // Determine the duration of the period.
-      if (first < m_lastUpdateTime)
-        {
-          first = m_lastUpdateTime;
-        }
-      if (m_stateTab.size () > 1)
-        {
-          last = m_timeTab.at (1);
-          if (last > now)
-            {
-              last = now;
-            }
-        }
-      else
-        {
-          last = now;
-        }
-      duration = last - first;
-      // Determine the energy consumption of the period.
-      if (duration != Seconds (0.0))
-        {
-          double nbsentBytes;
-          double nbrecvBytes;
-          double nbsentPkts;
-          double nbrecvPkts;
-          if (last != now)
-            {
-              nbsentBytes = (double) m_sentBytesNbTab.front ();
-              nbrecvBytes = (double) m_recvBytesNbTab.front ();
-              nbsentPkts = (double) m_sentPktsNbTab.front ();
-              nbrecvPkts = (double) m_recvPktsNbTab.front ();
-            }
-          else
-            {
-              GetNbRecv ();
-              GetNbSent ();
-              nbrecvBytes = m_lastNbRecvBytes;
-              nbsentBytes = m_lastNbSentBytes;
-              nbrecvPkts = m_lastNbRecvPkts;
-              nbsentPkts = m_lastNbSentPkts;
-            }
-          //NS_LOG_UNCOND ("NbSentBytes " << nbSentBytes);
-          switch (state)
-            {
-            case 0:
-              //NS_LOG_UNCOND ("Case 0");
-              conso += m_offConso * duration.GetSeconds ();
-              break;
-            case 1:
-              //NS_LOG_UNCOND ("Case 1 idle " << m_idleConso << " duration " << duration.GetSeconds () << " nbBytes " << nbBytes << " ByteEnergy "  << m_stateByteEnergy.at (state));
-              conso += m_idleConso * duration.GetSeconds () +
-                       (nbrecvBytes * m_stateRecvByteEnergy.at (state) * 1E-9) +
-                       (nbsentBytes * m_stateSentByteEnergy.at (state) * 1E-9) +
-                       (nbrecvPkts * m_stateRecvPktEnergy.at (state) * 1E-9) +
-                       (nbsentPkts * m_stateSentPktEnergy.at (state) * 1E-9);
-              break;
-              case 2: {
-                //NS_LOG_UNCOND ("Case 2");
-                Time switchduration = m_timeTab.at (1) - m_timeTab.front ();
-                conso += (m_switchEnergyTab.front () * duration.GetSeconds () /
-                          switchduration.GetSeconds ());
-                break;
-              }
-            default:
-              //NS_LOG_UNCOND ("Case default");
-              conso += m_stateIdleConso.at (state) * duration.GetSeconds () +
-                       (nbrecvBytes * m_stateRecvByteEnergy.at (state) * 1E-9) +
-                       (nbsentBytes * m_stateSentByteEnergy.at (state) * 1E-9) +
-                       (nbrecvPkts * m_stateRecvPktEnergy.at (state) * 1E-9) +
-                       (nbsentPkts * m_stateSentPktEnergy.at (state) * 1E-9);
-            }
-        }
-      else if (now == Seconds (0.0))
-        {
-          switch (state)
-            {
-            case 0:
-              //NS_LOG_UNCOND ("Case 0bis");
-              totconso = m_offConso;
-              break;
-            case 1:
-              //NS_LOG_UNCOND ("Case 1bis");
-              totconso = m_idleConso;
-              break;
-              case 2: {
-                //NS_LOG_UNCOND ("Case 2bis");
-                Time switchduration = m_timeTab.at (1) - m_timeTab.front ();
-                totconso = (m_switchEnergyTab.front () / switchduration.GetSeconds ());
-                break;
-              }
-            default:
-              //NS_LOG_UNCOND ("Case defaultbis");
-              totconso = m_stateIdleConso.at (state);
-            }
-        }
-      // Go to the next period.
-      if (last == now)
-        {
-          end = true;
-        }
-      else
-        {
-          if (state == 2)
-            {
-              m_switchEnergyTab.erase (m_switchEnergyTab.begin ());
-            }
-          m_timeTab.erase (m_timeTab.begin ());
-          m_stateTab.erase (m_stateTab.begin ());
-        }
-    }
-  // Compute the total power consumption;
-  if (firsttime != now)
-    {
-      Time tottime = now - m_lastUpdateTime;
-      totconso = conso / tottime.GetSeconds ();
-    }
-  m_lastUpdateTime = now;
-  return totconso;
+  return m_timeline.GetAveragePower (
+      MakeCallback (&CompleteNetdeviceEnergyModel::GetPeriodEnergy, this),
+      MakeCallback (&CompleteNetdeviceEnergyModel::GetStatePower, this));
 }
 
-void
-CompleteNetdeviceEnergyModel::UpdateState (uint32_t state, double energy, Time duration)
+double
+CompleteNetdeviceEnergyModel::GetStatePower (uint32_t state)
 {
-  if (duration != Seconds (0.0))
+  switch (state)
     {
-      // Add the switch
-      if ((m_timeTab.back () == Simulator::Now () && (Simulator::Now () != Seconds (0.0))))
-        {
-          m_stateTab.pop_back ();
-          m_stateTab.push_back (2);
-          m_switchEnergyTab.push_back (energy);
-        }
-      else
-        {
-          m_stateTab.push_back (2);
-          m_timeTab.push_back (Simulator::Now ());
-          m_switchEnergyTab.push_back (energy);
-        }
+    case 0:
+      return m_offConso;
+    case 1:
+      return m_idleConso;
+    default:
+      return m_stateIdleConso.at (state);
     }
-  // Add the next state
-  if ((m_timeTab.back () == Simulator::Now () + duration) &&
-      (Simulator::Now () + duration != Seconds (0.0)))
+}
+
+double
+CompleteNetdeviceEnergyModel::GetPeriodEnergy (const StateTimeline::Period &period, double seconds,
+                                               bool ongoing)
+{
+  // Traffic of past periods was recorded when the state switched
+  double nbrecvBytes = 0.0;
+  double nbsentBytes = 0.0;
+  double nbrecvPkts = 0.0;
+  double nbsentPkts = 0.0;
+  if (ongoing)
     {
-      m_stateTab.pop_back ();
-      m_stateTab.push_back (state);
       GetNbRecv ();
       GetNbSent ();
-      double nbrecvBytes = m_lastNbRecvBytes;
-      double nbsentBytes = m_lastNbSentBytes;
-      double nbrecvPkts = m_lastNbRecvPkts;
-      double nbsentPkts = m_lastNbSentPkts;
-      m_recvBytesNbTab.push_back (nbrecvBytes);
-      m_sentBytesNbTab.push_back (nbsentBytes);
-      m_recvPktsNbTab.push_back (nbrecvPkts);
-      m_sentPktsNbTab.push_back (nbsentPkts);
-      //m_lastUpdateTime = Simulator::Now ();
+      nbrecvBytes = m_lastNbRecvBytes;
+      nbsentBytes = m_lastNbSentBytes;
+      nbrecvPkts = m_lastNbRecvPkts;
+      nbsentPkts = m_lastNbSentPkts;
     }
-  else
+  else if (period.counters.size () == 4)
     {
-      m_stateTab.push_back (state);
-      m_timeTab.push_back (Simulator::Now () + duration);
-      GetNbRecv ();
-      GetNbSent ();
-      double nbrecvBytes = m_lastNbRecvBytes;
-      double nbsentBytes = m_lastNbSentBytes;
-      double nbrecvPkts = m_lastNbRecvPkts;
-      double nbsentPkts = m_lastNbSentPkts;
-      m_recvBytesNbTab.push_back (nbrecvBytes);
-      m_sentBytesNbTab.push_back (nbsentBytes);
-      m_recvPktsNbTab.push_back (nbrecvPkts);
-      m_sentPktsNbTab.push_back (nbsentPkts);
-      //m_lastUpdateTime = Simulator::Now ();
+      nbrecvBytes = period.counters[0];
+      nbsentBytes = period.counters[1];
+      nbrecvPkts = period.counters[2];
+      nbsentPkts = period.counters[3];
     }
+  uint32_t state = period.state;
+  return GetStatePower (state) * seconds +
+         (nbrecvBytes * m_stateRecvByteEnergy.at (state) * 1E-9) +
+         (nbsentBytes * m_stateSentByteEnergy.at (state) * 1E-9) +
+         (nbrecvPkts * m_stateRecvPktEnergy.at (state) * 1E-9) +
+         (nbsentPkts * m_stateSentPktEnergy.at (state) * 1E-9);
+}
+
+void
+CompleteNetdeviceEnergyModel::UpdateState (uint32_t state, double energy, Time duration)
+{
+  GetNbRecv ();
+  GetNbSent ();
+  m_timeline.Record ({m_lastNbRecvBytes, m_lastNbSentBytes, m_lastNbRecvPkts, m_lastNbSentPkts});
+  m_timeline.Update (state, energy, duration);
 }
 
 } // namespace ns3
@@ -24,6 +24,7 @@
 #include <vector>
 #include "ns3/object-vector.h"
 #include "netdevice-energy-model.h"
+#include "state-timeline.h"
 #include "ns3/nstime.h"
 #include "ns3/traced-value.h"
 
@@ -171,8 +172,17 @@ private:
 
   void GetNbSent (void);
 
+  /**
+   * \returns Power consumption (in Watts) of a state.
+   */
+  double GetStatePower (uint32_t state);
+
+  /**
+   * \returns Energy consumed (in Joules) during a period of the timeline.
+   */
+  double GetPeriodEnergy (const StateTimeline::Period &period, double seconds, bool ongoing);
+
 private:
-  Time m_lastUpdateTime;
   Ptr<NetDevice> m_netdevice;
 
   // To deal with the different states
@@ -199,13 +209,7 @@ private:
   double m_recvPktEnergy;
 
   // To deal with the state changes
-  std::vector<uint32_t> m_stateTab;
-  std::vector<Time> m_timeTab;
-  std::vector<double> m_switchEnergyTab;
-  std::vector<uint32_t> m_sentBytesNbTab;
-  std::vector<uint32_t> m_recvBytesNbTab;
-  std::vector<uint32_t> m_sentPktsNbTab;
-  std::vector<uint32_t> m_recvPktsNbTab;
+  StateTimeline m_timeline;
 };
 
 } // namespace ns3
@@ -20,9 +20,10 @@
  * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
  */
 
+#include <algorithm>
 #include "data-rate-netdevice-energy-model.h"
-#include "ns3/channel.h"
 #include "ns3/data-rate.h"
+#include "ns3/abort.h"
 
 namespace ns3 {
 
@@ -38,7 +39,9 @@ DataRateNetdeviceEnergyModel::GetTypeId (void)
 }
 
 DataRateNetdeviceEnergyModel::DataRateNetdeviceEnergyModel ()
+    : m_installRate (0), m_lpiConso (0.0), m_lastBusyTime (Seconds (0))
 {
+  m_timeline.Reset (GetNetdeviceState ());
 }
 
 DataRateNetdeviceEnergyModel::~DataRateNetdeviceEnergyModel ()
@@ -62,11 +65,21 @@ DataRateNetdeviceEnergyModel::SetConsumptionValues (std::map<uint64_t, double> v
   m_values = values;
 }
 
+void
+DataRateNetdeviceEnergyModel::SetLpiConsumption (double conso)
+{
+  m_lpiConso = conso;
+}
+
 void
 DataRateNetdeviceEnergyModel::SetNetdevice (Ptr<NetDevice> netdevice)
 {
   NS_ASSERT (netdevice != NULL);
   m_netdevice = netdevice;
+  m_device = DynamicCast<PointToPointEthernetNetDevice> (netdevice);
+  NS_ABORT_MSG_IF (m_device == 0, "dataRate interface model requires PointToPointEthernet");
+  m_installRate = m_device->GetDataRate ().GetBitRate ();
+  m_timeline.Reset (GetNetdeviceState (), m_installRate);
 }
 
 Ptr<NetDevice>
@@ -78,11 +91,73 @@ DataRateNetdeviceEnergyModel::GetNetdevice () const
 double
 DataRateNetdeviceEnergyModel::GetPowerConsumption (void)
 {
-  Ptr<Channel> channel = m_netdevice->GetChannel ();
-  uint64_t bps = channel->GetDataRate ().GetBitRate ();
-  uint64_t current_bps = bps * channel->GetChannelUsage ();
+  double power = m_timeline.GetAveragePower (
+      MakeCallback (&DataRateNetdeviceEnergyModel::GetPeriodEnergy, this),
+      MakeCallback (&DataRateNetdeviceEnergyModel::GetStatePower, this));
+  m_lastBusyTime = m_device->GetTxBusyTime ();
+  return power;
+}
 
-  return m_values[bps] * (current_bps / m_unit);
+double
+DataRateNetdeviceEnergyModel::GetOnPower (uint64_t bps, double usage)
+{
+  uint64_t current_bps = bps * usage;
+
+  // Ports at a rate the template does not list (e.g. the OpenFlow channel
+  // ones) draw nothing, a rate reached by ALR must be listed
+  std::map<uint64_t, double>::const_iterator it = m_values.find (bps);
+  if (it == m_values.end ())
+    {
+      NS_ABORT_MSG_IF (bps != m_installRate,
+                       "No consumption for " << DataRate (bps) << " in the interface model");
+      return 0.0;
+    }
+  return it->second * (current_bps / m_unit);
+}
+
+double
+DataRateNetdeviceEnergyModel::GetStatePower (uint32_t state)
+{
+  switch (state)
+    {
+    case 0:
+      return 0.0;
+    case 1:
+      return GetOnPower (m_device->GetDataRate ().GetBitRate (), m_device->GetTxUsageEwma ());
+    default:
+      return m_lpiConso;
+    }
+}
+
+double
+DataRateNetdeviceEnergyModel::GetPeriodEnergy (const StateTimeline::Period &period, double seconds,
+                                               bool ongoing)
+{
+  if (period.state != 1)
+    {
+      return GetStatePower (period.state) * seconds;
+    }
+
+  // Busy time of past periods was recorded when the state switched
+  double busy = 0.0;
+  if (ongoing)
+    {
+      busy = (m_device->GetTxBusyTime () - m_lastBusyTime).GetSeconds ();
+    }
+  else if (!period.counters.empty ())
+    {
+      busy = period.counters[0];
+    }
+  return GetOnPower (period.rate, std::min (busy / seconds, 1.0)) * seconds;
+}
+
+void
+DataRateNetdeviceEnergyModel::UpdateState (uint32_t state, double energy, Time duration)
+{
+  Time busy = m_device->GetTxBusyTime ();
+  m_timeline.Record ({(busy - m_lastBusyTime).GetSeconds ()});
+  m_lastBusyTime = busy;
+  m_timeline.Update (state, energy, duration, m_device->GetDataRate ().GetBitRate ());
 }
 
 } // namespace ns3
@@ -68,11 +68,9 @@ LinearNetdeviceEnergyModel::GetTypeId (void)
 
 LinearNetdeviceEnergyModel::LinearNetdeviceEnergyModel ()
 {
-  m_lastUpdateTime = Seconds (0.0);
   m_slastPos = 0;
   m_rlastPos = 0;
-  m_stateTab.push_back (GetNetdeviceState ());
-  m_timeTab.push_back (Seconds (0.0));
+  m_timeline.Reset (GetNetdeviceState ());
 }
 
 LinearNetdeviceEnergyModel::~LinearNetdeviceEnergyModel ()
@@ -250,170 +248,48 @@ LinearNetdeviceEnergyModel::GetNbRecvBytes (void)
 double
 LinearNetdeviceEnergyModel::GetPowerConsumption (void)
 {
-  double totconso = 0.0;
-  Time now = Simulator::Now ();
-  Time firsttime = m_timeTab.front ();
-  bool end = false;
-  double conso = 0.0;
-  while (!end)
-    {
-      // Set the parameters of the period.
-      uint32_t state = m_stateTab.front ();
-      Time first = m_timeTab.front ();
-      Time last;
-      Time duration;
-      // Determine the duration of the period.
-      if (first < m_lastUpdateTime)
-        {
-          first = m_lastUpdateTime;
-        }
-      if (m_stateTab.size () > 1)
-        {
-          last = m_timeTab.at (1);
-          if (last > now)
-            {
-              last = now;
-            }
-        }
-      else
-        {
-          last = now;
-        }
-      duration = last - first;
-      if (duration.GetSeconds () < 0)
-        {
-          NS_LOG_UNCOND ("last " << last.GetSeconds () << " first " << first.GetSeconds ()
-                                 << " m_lastUpdateTime " << m_lastUpdateTime << " now " << now);
-          for (uint32_t k = 0; k < m_timeTab.size (); k++)
-            {
-              NS_LOG_UNCOND ("  " << m_timeTab[k].GetSeconds ());
-            }
-        }
-      // Determine the energy consumption of the period.
-      if (duration != Seconds (0.0))
-        {
-          double nbBytes;
-          if (last != now)
-            {
-              nbBytes = (double) m_bytesNbTab.front ();
-            }
-          else
-            {
-              nbBytes = GetNbRecvBytes () + GetNbSentBytes ();
-            }
-          //NS_LOG_UNCOND ("NbSentBytes " << nbSentBytes);
-          switch (state)
-            {
-            case 0:
-              //NS_LOG_UNCOND ("Case 0");
-              conso += m_offConso * duration.GetSeconds ();
-              break;
-            case 1:
-              //NS_LOG_UNCOND ("Case 1 idle " << m_idleConso << " duration " << duration.GetSeconds () << " nbBytes " << nbBytes << " ByteEnergy "  << m_stateByteEnergy.at (state));
-              conso += m_idleConso * duration.GetSeconds () +
-                       (nbBytes * m_stateByteEnergy.at (state) * 1E-9);
-              break;
-              case 2: {
-                //NS_LOG_UNCOND ("Case 2");
-                Time switchduration = m_timeTab.at (1) - m_timeTab.front ();
-                conso += (m_switchEnergyTab.front () * duration.GetSeconds () /
-                          switchduration.GetSeconds ());
-                break;
-              }
-            default:
-              //NS_LOG_UNCOND ("Case default");
-              conso += m_stateIdleConso.at (state) * duration.GetSeconds () +
-                       (nbBytes * m_stateByteEnergy.at (state) * 1E-9);
-            }
-          if (conso < 0)
-            {
-              NS_LOG_UNCOND ("conso " << conso << " state " << state << " duration "
-                                      << duration.GetSeconds ());
-            }
-        }
-      else if (now == Seconds (0.0))
-        {
-          switch (state)
-            {
-            case 0:
-              //NS_LOG_UNCOND ("Case 0bis");
-              totconso = m_offConso;
-              break;
-            case 1:
-              //NS_LOG_UNCOND ("Case 1bis");
-              totconso = m_idleConso;
-              break;
-              case 2: {
-                //NS_LOG_UNCOND ("Case 2bis");
-                Time switchduration = m_timeTab.at (1) - m_timeTab.front ();
-                totconso = (m_switchEnergyTab.front () / switchduration.GetSeconds ());
-                break;
-              }
-            default:
-              //NS_LOG_UNCOND ("Case defaultbis");
-              totconso = m_stateIdleConso.at (state);
-            }
-        }
-      // Go to the next period.
-      if (last == now)
-        {
-          end = true;
-        }
-      else
-        {
-          if (state == 2)
-            {
-              m_switchEnergyTab.erase (m_switchEnergyTab.begin ());
-            }
-          m_timeTab.erase (m_timeTab.begin ());
-          m_stateTab.erase (m_stateTab.begin ());
-        }
-    }
-  // Compute the total power consumption;
-  if (firsttime != now)
-    {
-      Time tottime = now - m_lastUpdateTime;
-      totconso = conso / tottime.GetSeconds ();
-    }
-  m_lastUpdateTime = now;
-  return totconso;
+  return m_timeline.GetAveragePower (
+      MakeCallback (&LinearNetdeviceEnergyModel::GetPeriodEnergy, this),
+      MakeCallback (&LinearNetdeviceEnergyModel::GetStatePower, this));
 }
 
-void
-LinearNetdeviceEnergyModel::UpdateState (uint32_t state, double energy, Time duration)
+double
+LinearNetdeviceEnergyModel::GetStatePower (uint32_t state)
 {
-  if (duration != Seconds (0.0))
+  switch (state)
     {
-      // Add the switch
-      if ((m_timeTab.back () == Simulator::Now () && (Simulator::Now () != Seconds (0.0))))
-        {
-          m_stateTab.pop_back ();
-          m_stateTab.push_back (2);
-          m_switchEnergyTab.push_back (energy);
-        }
-      else
-        {
-          m_stateTab.push_back (2);
-          m_timeTab.push_back (Simulator::Now ());
-          m_switchEnergyTab.push_back (energy);
-        }
+    case 0:
+      return m_offConso;
+    case 1:
+      return m_idleConso;
+    default:
+      return m_stateIdleConso.at (state);
     }
-  // Add the next state
-  if ((m_timeTab.back () == Simulator::Now () + duration) &&
-      (Simulator::Now () + duration != Seconds (0.0)))
+}
+
+double
+LinearNetdeviceEnergyModel::GetPeriodEnergy (const StateTimeline::Period &period, double seconds,
+                                             bool ongoing)
+{
+  // Bytes of past periods were recorded when the state switched
+  double nbBytes = 0.0;
+  if (ongoing)
     {
-      m_stateTab.pop_back ();
-      m_stateTab.push_back (state);
-      m_bytesNbTab.push_back (GetNbRecvBytes () + GetNbSentBytes ());
-      //m_lastUpdateTime = Simulator::Now ();
+      nbBytes = GetNbRecvBytes () + GetNbSentBytes ();
     }
-  else
+  else if (!period.counters.empty ())
     {
-      m_stateTab.push_back (state);
-      m_timeTab.push_back (Simulator::Now () + duration);
-      m_bytesNbTab.push_back (GetNbRecvBytes () + GetNbSentBytes ());
-      //m_lastUpdateTime = Simulator::Now ();
+      nbBytes = period.counters[0];
     }
+  return GetStatePower (period.state) * seconds +
+         (nbBytes * m_stateByteEnergy.at (period.state) * 1E-9);
+}
+
+void
+LinearNetdeviceEnergyModel::UpdateState (uint32_t state, double energy, Time duration)
+{
+  m_timeline.Record ({GetNbRecvBytes () + GetNbSentBytes ()});
+  m_timeline.Update (state, energy, duration);
 }
 
 } // namespace ns3
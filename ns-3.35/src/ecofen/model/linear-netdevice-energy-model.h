@@ -24,6 +24,7 @@
 #include <vector>
 #include "ns3/object-vector.h"
 #include "netdevice-energy-model.h"
+#include "state-timeline.h"
 #include "ns3/nstime.h"
 #include "ns3/traced-value.h"
 
@@ -137,6 +138,16 @@ private:
 
   double GetNbSentBytes (void);
 
+  /**
+   * \returns Power consumption (in Watts) of a state.
+   */
+  double GetStatePower (uint32_t state);
+
+  /**
+   * \returns Energy consumed (in Joules) during a period of the timeline.
+   */
+  double GetPeriodEnergy (const StateTimeline::Period &period, double seconds, bool ongoing);
+
 private:
   // To deal with the states
   std::vector<double> m_stateIdleConso;
@@ -152,11 +163,7 @@ private:
   Ptr<NetDevice> m_netdevice;
 
   // To deal with the state changes
-  Time m_lastUpdateTime;
-  std::vector<uint32_t> m_stateTab;
-  std::vector<Time> m_timeTab;
-  std::vector<double> m_switchEnergyTab;
-  std::vector<uint32_t> m_bytesNbTab;
+  StateTimeline m_timeline;
 };
 
 } // namespace ns3
@@ -18,25 +18,18 @@
  * Author: Anne-Cecile Orgerie <anne-cecile.orgerie@irisa.fr>
  */
 
-#include "node-energy-model.h"
+#include <cmath>
 #include "lpi-link.h"
 #include "ns3/uinteger.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
-#include "ns3/ipv4.h"
-#include "ns3/ipv6.h"
-#include "ns3/node.h"
 #include "ns3/netdevice-energy-model.h"
-#include "ns3/basic-netdevice-energy-model.h"
-#include "ns3/linear-netdevice-energy-model.h"
-#include "ns3/complete-netdevice-energy-model.h"
-#include "ns3/queue.h"
-#include "ns3/point-to-point-net-device.h"
-#include "ns3/csma-net-device.h"
 
 namespace ns3 {
 
+NS_LOG_COMPONENT_DEFINE ("LpiLink");
+
 NS_OBJECT_ENSURE_REGISTERED (LpiLink);
 
 TypeId
@@ -48,25 +41,37 @@ LpiLink::GetTypeId (void)
           .AddConstructor<LpiLink> ()
           .AddAttribute ("State", "LPI State (Sleep 0, Awake 1)", UintegerValue (1),
                          MakeUintegerAccessor (&LpiLink::m_state), MakeUintegerChecker<uint32_t> ())
-      /*.AddAttribute ("SwitchOffEnergy","The energy used to switch off a node.",
-                   DoubleValue (),
-                   MakeDoubleAccessor (&AlrLink::m_switchOffEnergy),
-                   MakeDoubleChecker<double> ())
-    .AddAttribute ("SwitchOffDuration","The duration of a switch off a node in seconds.",
-                   DoubleValue (),
-                   MakeDoubleAccessor (&AlrLink::m_switchOffDuration),
-                   MakeDoubleChecker<double> ())
-    .AddAttribute ("SwitchOnDuration","The duration of a switch on a node in seconds.",
-                   DoubleValue (),
-                   MakeDoubleAccessor (&AlrLink::m_switchOnDuration),
-                   MakeDoubleChecker<double> ())*/
-      ;
+          .AddAttribute ("IdleTime", "The time both net devices must stay idle before sleeping.",
+                         TimeValue (Seconds (0)), MakeTimeAccessor (&LpiLink::m_timeIdle),
+                         MakeTimeChecker ())
+          .AddAttribute ("SleepTime", "The duration of a switch to sleep (T_s).",
+                         TimeValue (MicroSeconds (182)), MakeTimeAccessor (&LpiLink::m_timeToSleep),
+                         MakeTimeChecker ())
+          .AddAttribute ("WakeUpTime", "The duration of a wake up (T_w).",
+                         TimeValue (NanoSeconds (16500)),
+                         MakeTimeAccessor (&LpiLink::m_timeToWakeUp), MakeTimeChecker ())
+          .AddAttribute ("RefreshTime", "The duration of a refresh (T_r).",
+                         TimeValue (MicroSeconds (198)),
+                         MakeTimeAccessor (&LpiLink::m_timeToRefresh), MakeTimeChecker ())
+          .AddAttribute ("QuietTime", "The time between two refreshes (T_q).",
+                         TimeValue (MilliSeconds (20)), MakeTimeAccessor (&LpiLink::m_timeQuiet),
+                         MakeTimeChecker ())
+          .AddAttribute ("SleepEnergy", "The energy used by a net device to go to sleep.",
+                         DoubleValue (0.0), MakeDoubleAccessor (&LpiLink::m_energyToSleep),
+                         MakeDoubleChecker<double> ())
+          .AddAttribute ("WakeUpEnergy", "The energy used by a net device to wake up.",
+                         DoubleValue (0.0), MakeDoubleAccessor (&LpiLink::m_energyToWakeUp),
+                         MakeDoubleChecker<double> ())
+          .AddAttribute ("RefreshEnergy", "The energy used by a net device for a refresh.",
+                         DoubleValue (0.0), MakeDoubleAccessor (&LpiLink::m_energyToRefresh),
+                         MakeDoubleChecker<double> ())
+          .AddAttribute ("LpiState", "The net device energy model state used while sleeping.",
+                         UintegerValue (3), MakeUintegerAccessor (&LpiLink::m_lpiStateNb),
+                         MakeUintegerChecker<uint32_t> ());
   return tid;
 }
 
-void (LpiLink::*fp) (uint32_t n) = &LpiLink::Refresh;
-
-LpiLink::LpiLink ()
+LpiLink::LpiLink () : m_state (1)
 {
 }
 
@@ -74,19 +79,37 @@ LpiLink::~LpiLink ()
 {
 }
 
+void
+LpiLink::DoDispose (void)
+{
+  m_sleepEvent.Cancel ();
+  m_evaluateEvent.Cancel ();
+  m_link = NetDeviceContainer ();
+  m_netdevs[0] = 0;
+  m_netdevs[1] = 0;
+  Object::DoDispose ();
+}
+
 void
 LpiLink::SetLink (NetDeviceContainer link)
 {
-  //NS_ASSERT (link != NULL);
-  uint32_t n = link.GetN ();
-  if (n != 2)
+  if (link.GetN () != 2)
     {
       NS_FATAL_ERROR ("You did not apply LPI to a link!");
     }
-  else
+  for (uint32_t i = 0; i < 2; i++)
     {
-      m_link = link;
+      m_netdevs[i] = DynamicCast<PointToPointEthernetNetDevice> (link.Get (i));
+      NS_ABORT_MSG_IF (m_netdevs[i] == 0, "LPI requires PointToPointEthernetNetDevice links");
+      m_netdevs[i]->TraceConnectWithoutContext ("MacTx",
+                                                MakeCallback (&LpiLink::NotifyTxRequest, this));
+      m_netdevs[i]->TraceConnectWithoutContext ("TxQueueEmpty",
+                                                MakeCallback (&LpiLink::NotifyTxIdle, this));
     }
+  m_link = link;
+
+  // A link carrying no traffic sleeps from the start
+  m_evaluateEvent = Simulator::ScheduleNow (&LpiLink::NotifyTxIdle, this);
 }
 
 NetDeviceContainer
@@ -95,143 +118,98 @@ LpiLink::GetLink (void) const
   return m_link;
 }
 
-void
-LpiLink::PutToSleep (void)
+bool
+LpiLink::IsSleeping (void) const
 {
-  Time now = Simulator::Now ();
-  m_state = 0;
-  NetDeviceContainer netdevc = GetLink ();
-  uint32_t i;
-  uint32_t n = 2;
-  // Make the switch to sleep state
-  for (i = 0; i < n; i++)
-    {
-      Ptr<NetdeviceEnergyModel> ndem;
-      Ptr<NetDevice> netdevi = netdevc.Get (i);
-      ndem = netdevi->GetObject<NetdeviceEnergyModel> ();
-      ndem->UpdateState (m_lpiStateNb[i], m_energyToSleep[i], Seconds (m_timeToSleep));
-    }
-  //Plan next refresh
-  Ptr<LpiLink> lpilink = m_link.Get (0)->GetObject<LpiLink> ();
-  Simulator::Schedule (Seconds (m_timeQuiet), fp, lpilink, 0);
-  //TODO empêcher le lien de communiquer
+  return m_state == 0;
 }
 
 void
-LpiLink::WakeUp (void)
+LpiLink::NotifyTxRequest (Ptr<const Packet> packet)
 {
-  m_state = 1;
-  NetDeviceContainer netdevc = GetLink ();
-  uint32_t i;
-  uint32_t n = 2;
-  // Make the switch to on state
-  for (i = 0; i < n; i++)
+  m_sleepEvent.Cancel ();
+  if (m_state == 0)
     {
-      Ptr<NetdeviceEnergyModel> ndem;
-      Ptr<NetDevice> netdevi = netdevc.Get (i);
-      ndem = netdevi->GetObject<NetdeviceEnergyModel> ();
-      ndem->UpdateState (
-          ndem->GetNetdeviceOnState (), m_energyToWakeUp[i],
-          Seconds (m_timeToWakeUp)); //TODO vérifier comment se passe le recouvrement de switch
+      WakeUp ();
     }
-  //TODO autoriser le lien à communiquer à partir de now + Seconds (m_timeToWakeUp)
 }
 
 void
-LpiLink::Refresh (uint32_t n)
+LpiLink::NotifyTxIdle (void)
 {
-  // Refresh only if it's still needed = still sleeping
-  n++;
-  if (m_state == 0)
+  if (m_state == 0 || m_sleepEvent.IsRunning ())
     {
-      NetDeviceContainer netdevc = GetLink ();
-      Ptr<Queue> queue1, queue2;
-      Ptr<NetDevice> netdev1 = netdevc.Get (0);
-      Ptr<NetDevice> netdev2 = netdevc.Get (1);
-      // Warning: works only for Csma and PointToPoint net devices.
-      if (netdev1->GetInstanceTypeId ().GetName () == "ns3::PointToPointNetDevice")
-        {
-          queue1 = netdev1->GetObject<PointToPointNetDevice> ()->GetQueue ();
-        }
-      else if (netdev1->GetInstanceTypeId ().GetName () == "ns3::CsmaNetDevice")
-        {
-          queue1 = netdev1->GetObject<CsmaNetDevice> ()->GetQueue ();
-        }
-      if (netdev2->GetInstanceTypeId ().GetName () == "ns3::PointToPointNetDevice")
-        {
-          queue2 = netdev2->GetObject<PointToPointNetDevice> ()->GetQueue ();
-        }
-      else if (netdev2->GetInstanceTypeId ().GetName () == "ns3::CsmaNetDevice")
-        {
-          queue2 = netdev2->GetObject<CsmaNetDevice> ()->GetQueue ();
-        }
-      // If queues are not empty -> Wake up!
-      if ((!queue1->IsEmpty ()) || (!queue2->IsEmpty ()))
-        {
-          WakeUp ();
-        }
-      // If queues are empty -> stay asleep.
-      else
-        {
-          uint32_t i;
-          uint32_t n = 2;
-          for (i = 0; i < n; i++)
-            {
-              Ptr<NetdeviceEnergyModel> ndem;
-              Ptr<NetDevice> netdevi = netdevc.Get (i);
-              ndem = netdevi->GetObject<NetdeviceEnergyModel> ();
-              ndem->UpdateState (m_lpiStateNb[i], m_energyToRefresh[i], Seconds (m_timeToRefresh));
-            }
-          // Plan the next Refresh
-          Ptr<LpiLink> lpilink = m_link.Get (0)->GetObject<LpiLink> ();
-          Simulator::Schedule (Seconds (m_timeQuiet), fp, lpilink, n);
-        }
+      return;
     }
-}
-
-void
-LpiLink::Watch (void)
-{
-  NetDeviceContainer netdevc = GetLink ();
-  Ptr<Queue> queue1, queue2;
-  Ptr<NetDevice> netdev1 = netdevc.Get (0);
-  Ptr<NetDevice> netdev2 = netdevc.Get (1);
-  // Warning: works only for Csma and PointToPoint net devices.
-  if (netdev1->GetInstanceTypeId ().GetName () == "ns3::PointToPointNetDevice")
+  if (!m_netdevs[0]->IsTxIdle () || !m_netdevs[1]->IsTxIdle ())
     {
-      queue1 = netdev1->GetObject<PointToPointNetDevice> ()->GetQueue ();
+      return;
     }
-  else if (netdev1->GetInstanceTypeId ().GetName () == "ns3::CsmaNetDevice")
+  if (m_timeIdle.IsZero ())
     {
-      queue1 = netdev1->GetObject<CsmaNetDevice> ()->GetQueue ();
+      PutToSleep ();
     }
-  if (netdev2->GetInstanceTypeId ().GetName () == "ns3::PointToPointNetDevice")
+  else
     {
-      queue2 = netdev2->GetObject<PointToPointNetDevice> ()->GetQueue ();
+      m_sleepEvent = Simulator::Schedule (m_timeIdle, &LpiLink::PutToSleep, this);
     }
-  else if (netdev2->GetInstanceTypeId ().GetName () == "ns3::CsmaNetDevice")
+}
+
+void
+LpiLink::PutToSleep (void)
+{
+  if (m_state == 0)
     {
-      queue2 = netdev2->GetObject<CsmaNetDevice> ()->GetQueue ();
+      return;
     }
-  // If awake
+  NS_LOG_LOGIC ("Link " << m_netdevs[0] << "-" << m_netdevs[1] << " goes to sleep");
+  m_state = 0;
+  m_lastChange = Simulator::Now ();
+  UpdateEnergy (true, m_energyToSleep, m_timeToSleep);
+  m_evaluateEvent.Cancel ();
+  m_evaluateEvent = Simulator::Schedule (m_timeToSleep, &LpiLink::NotifyTxIdle, this);
+}
+
+void
+LpiLink::WakeUp (void)
+{
   if (m_state == 1)
     {
-      // If empty queue -> put to sleep
-      if ((queue1->IsEmpty ()) && (queue2->IsEmpty ()))
-        {
-          PutToSleep ();
-        }
-      // Else -> nothing = link communicating
+      return;
     }
-  // If sleeping
-  else
+  Time now = Simulator::Now ();
+  // A wake up can only start once the link is asleep
+  Time start = Max (now, m_lastChange + m_timeToSleep);
+  Time ready = start + m_timeToWakeUp;
+  NS_LOG_LOGIC ("Link " << m_netdevs[0] << "-" << m_netdevs[1] << " wakes up at "
+                        << ready.As (Time::S));
+
+  // Refreshes done while sleeping
+  Time quiet = start - m_lastChange - m_timeToSleep;
+  double refreshes =
+      std::floor (quiet.GetSeconds () / (m_timeQuiet + m_timeToRefresh).GetSeconds ());
+
+  m_state = 1;
+  m_lastChange = now;
+  m_netdevs[0]->HoldTransmissions (ready);
+  m_netdevs[1]->HoldTransmissions (ready);
+  UpdateEnergy (false, m_energyToWakeUp + refreshes * m_energyToRefresh, ready - now);
+  // The packets waking the link up may all be dropped
+  m_evaluateEvent.Cancel ();
+  m_evaluateEvent = Simulator::Schedule (ready - now, &LpiLink::NotifyTxIdle, this);
+}
+
+void
+LpiLink::UpdateEnergy (bool sleep, double energy, Time duration)
+{
+  for (uint32_t i = 0; i < 2; i++)
     {
-      // If queue not empty -> wake up
-      if ((!queue1->IsEmpty ()) || (!queue2->IsEmpty ()))
+      Ptr<NetdeviceEnergyModel> ndem = m_netdevs[i]->GetObject<NetdeviceEnergyModel> ();
+      if (ndem != 0)
         {
-          WakeUp ();
+          uint32_t state = sleep ? m_lpiStateNb : ndem->GetNetdeviceOnState ();
+          ndem->UpdateState (state, energy, duration);
         }
-      // Else -> nothing to do
     }
 }
 
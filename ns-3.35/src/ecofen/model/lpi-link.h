@@ -24,82 +24,88 @@
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/type-id.h"
-#include "ns3/net-device.h"
+#include "ns3/packet.h"
 #include "ns3/nstime.h"
-#include <vector>
-#include "ns3/object-vector.h"
+#include "ns3/event-id.h"
 #include "ns3/net-device-container.h"
+#include "ns3/point-to-point-ethernet-net-device.h"
 
 namespace ns3 {
 
 /**
  * \ingroup energy
- * \brief Base class for LPI functions on links.
+ * \brief Low Power Idle (IEEE 802.3az) on a point to point Ethernet link.
  *
- * Warning: this class only works with Csma and PointToPoint net devices.
+ * The link is driven by the events of its two net devices: it goes to sleep
+ * once both transmitters are idle (after an optional idle time) and wakes up
+ * as soon as a packet is handed to one of them. Transmissions are held while
+ * the PHYs wake up. The link is evaluated again once a switch is done, and
+ * at the start for links carrying no traffic. Refresh cycles done while
+ * sleeping are accounted for when the link wakes up, so a sleeping link
+ * schedules no event.
  */
-
 class LpiLink : public Object
 {
 public:
   static TypeId GetTypeId (void);
   LpiLink ();
   virtual ~LpiLink ();
-
   /**
-   * \brief Sets pointer to netdevices containing this LpiLink.
+   * \brief Sets the net devices of the link and hooks their transmit events.
    *
-   * \param link Pointer to the link containing this LpiLink.
+   * \param link The two PointToPointEthernetNetDevice of the link.
    */
   void SetLink (NetDeviceContainer link);
-
   /**
-   * \returns Pointer to link containing this LpiLink.
-   *
-   * When a subclass needs to get access to the underlying link base class to
-   * print the NetDeviceId for example, it can invoke this method.
+   * \returns The net devices of the link.
    */
   NetDeviceContainer GetLink (void) const;
-
   /**
-   *
+   * \returns true if the link is sleeping.
+   */
+  bool IsSleeping (void) const;
+  /**
    * To put the two net devices to sleep.
-   *
    */
   void PutToSleep (void);
-
   /**
    * To wake up the two net devices.
-   *
    */
   void WakeUp (void);
 
+protected:
+  virtual void DoDispose (void);
+
+private:
   /**
-   * To refresh the link.
-   *
+   * A packet was handed to one of the net devices.
    */
-  void Refresh (uint32_t n);
-
+  void NotifyTxRequest (Ptr<const Packet> packet);
   /**
-   * To have an automatic LPI function.
-   *
+   * One of the net devices went idle with an empty queue.
+   */
+  void NotifyTxIdle (void);
+  /**
+   * Forward a switch to (or from) the sleep state to the energy models of
+   * the two net devices.
    */
-  void Watch (void);
+  void UpdateEnergy (bool sleep, double energy, Time duration);
 
-private:
   NetDeviceContainer m_link;
-
+  Ptr<PointToPointEthernetNetDevice> m_netdevs[2];
   uint32_t m_state;
   Time m_lastChange;
-  double m_lpiConso;
-  double m_timeToSleep; // T_s
-  double m_timeToWakeUp; // T_w
-  double m_timeToRefresh; // T_r
-  double m_timeQuiet; // T_q
-  std::vector<double> m_energyToSleep;
-  std::vector<double> m_energyToWakeUp;
-  std::vector<double> m_energyToRefresh;
-  std::vector<double> m_lpiStateNb;
+  EventId m_sleepEvent;
+  EventId m_evaluateEvent;
+  Time m_timeIdle; // T_i, idle time before going to sleep
+  Time m_timeToSleep; // T_s
+  Time m_timeToWakeUp; // T_w
+  Time m_timeToRefresh; // T_r
+  Time m_timeQuiet; // T_q
+  double m_energyToSleep;
+  double m_energyToWakeUp;
+  double m_energyToRefresh;
+  uint32_t m_lpiStateNb;
 };
 
 } // namespace ns3
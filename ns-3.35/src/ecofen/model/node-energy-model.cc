@@ -151,24 +151,26 @@ NodeEnergyModel::UpdateEnergy (Ptr<Node> node)
 }
 
 void
-NodeEnergyModel::LogTotalPowerConsumption (Ptr<Node> node, Ptr<OutputStreamWrapper> streamWrapper)
+NodeEnergyModel::LogTotalPowerConsumption (Ptr<TraceWriter> writer, uint32_t entity)
 {
-  std::string nodeName = Names::FindName (node);
+  writer->Write (entity, {m_lastConso});
+}
 
-  std::ostream *stream = streamWrapper->GetStream ();
-  *stream << std::fixed << Simulator::Now ().GetSeconds () << ";" << nodeName << ";" << m_lastConso
-          << "\n";
+TraceSchema
+NodeEnergyModel::GetTraceSchema (void)
+{
+  return {"NodeName", {{"Consumption", TraceColumn::REAL}}};
 }
 
 void
-NodeEnergyModel::GetConsoLog (Time interval, Time stop, Ptr<Node> node,
-                              Ptr<OutputStreamWrapper> streamWrapper)
+NodeEnergyModel::GetConsoLog (Time interval, Time stop, Ptr<Node> node, Ptr<TraceWriter> writer)
 {
+  uint32_t entity = writer->AddEntity (Names::FindName (node));
+
   Time i = Seconds (0.0);
   while (i <= stop)
     {
-      Simulator::Schedule (i, &NodeEnergyModel::LogTotalPowerConsumption, this, node,
-                           streamWrapper);
+      Simulator::Schedule (i, &NodeEnergyModel::LogTotalPowerConsumption, this, writer, entity);
       i += interval;
     }
 }
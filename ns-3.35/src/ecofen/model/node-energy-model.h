@@ -27,7 +27,7 @@
 #include "ns3/node.h"
 #include "netdevice-energy-model.h"
 #include "ns3/simulator.h"
-#include "ns3/output-stream-wrapper.h"
+#include "ns3/trace-writer.h"
 
 namespace ns3 {
 
@@ -75,8 +75,7 @@ public:
   */
   void GetConso (Time interval, Time stop, Ptr<Node> node);
 
-  void GetConsoLog (Time interval, Time stop, Ptr<Node> node,
-                    Ptr<OutputStreamWrapper> streamWrapper);
+  void GetConsoLog (Time interval, Time stop, Ptr<Node> node, Ptr<TraceWriter> writer);
 
   /**
   * Getter for node state.
@@ -156,7 +155,9 @@ public:
   virtual void UpdateState (uint32_t state, double energy, Time duration);
 
   void UpdateEnergy (Ptr<Node> node);
-  void LogTotalPowerConsumption (Ptr<Node> node, Ptr<OutputStreamWrapper> streamWrapper);
+  void LogTotalPowerConsumption (Ptr<TraceWriter> writer, uint32_t entity);
+
+  static TraceSchema GetTraceSchema (void);
 
 private:
   /**
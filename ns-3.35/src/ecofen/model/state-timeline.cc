@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <algorithm>
+#include <iterator>
+#include "state-timeline.h"
+#include "ns3/simulator.h"
+
+namespace ns3 {
+
+static const uint32_t SWITCH_STATE = 2;
+
+StateTimeline::StateTimeline ()
+{
+  Reset (1);
+}
+
+void
+StateTimeline::Reset (uint32_t state, uint64_t rate)
+{
+  m_periods.clear ();
+  m_periods.push_back ({Seconds (0.0), state, 0.0, rate, {}});
+  m_lastUpdateTime = Seconds (0.0);
+}
+
+uint32_t
+StateTimeline::GetLastState (void) const
+{
+  return m_periods.back ().state;
+}
+
+uint32_t
+StateTimeline::GetNPeriods (void) const
+{
+  return m_periods.size ();
+}
+
+void
+StateTimeline::Update (uint32_t state, double energy, Time duration, uint64_t rate)
+{
+  Time now = Simulator::Now ();
+  // A new switch supersedes the periods scheduled after now
+  while (m_periods.size () > 1 && m_periods.back ().start > now)
+    {
+      m_periods.pop_back ();
+    }
+  if (!duration.IsZero ())
+    {
+      // Add the switch, replacing a period that would start now
+      double power = energy / duration.GetSeconds ();
+      if (m_periods.back ().start == now && !now.IsZero ())
+        {
+          m_periods.back ().state = SWITCH_STATE;
+          m_periods.back ().switchPower = power;
+          m_periods.back ().rate = rate;
+        }
+      else
+        {
+          m_periods.push_back ({now, SWITCH_STATE, power, rate, {}});
+        }
+    }
+  // Add the next state
+  Time next = now + duration;
+  if (m_periods.back ().start == next && !next.IsZero ())
+    {
+      m_periods.back ().state = state;
+      m_periods.back ().switchPower = 0.0;
+      m_periods.back ().rate = rate;
+    }
+  else
+    {
+      m_periods.push_back ({next, state, 0.0, rate, {}});
+    }
+}
+
+void
+StateTimeline::Record (const std::vector<double> &counters)
+{
+  Time now = Simulator::Now ();
+  // Periods scheduled in the future sit at the back, only a few steps away
+  std::deque<Period>::reverse_iterator it = m_periods.rbegin ();
+  while (it->start > now && std::next (it) != m_periods.rend ())
+    {
+      ++it;
+    }
+  std::vector<double> &values = it->counters;
+  if (values.size () < counters.size ())
+    {
+      values.resize (counters.size (), 0.0);
+    }
+  for (uint32_t i = 0; i < counters.size (); i++)
+    {
+      values[i] += counters[i];
+    }
+}
+
+double
+StateTimeline::GetAveragePower (EnergyCallback energy, PowerCallback power)
+{
+  Time now = Simulator::Now ();
+
+  if (now == m_lastUpdateTime)
+    {
+      // No elapsed time, return the power of the state active now
+      uint32_t i = 0;
+      while (i + 1 < m_periods.size () && m_periods[i + 1].start <= now)
+        {
+          i++;
+        }
+      const Period &period = m_periods[i];
+      if (period.state == SWITCH_STATE)
+        {
+          return period.switchPower;
+        }
+      return power (period.state);
+    }
+
+  double conso = 0.0;
+  while (true)
+    {
+      const Period &period = m_periods.front ();
+      bool hasNext = m_periods.size () > 1;
+      Time first = std::max (period.start, m_lastUpdateTime);
+      Time last = hasNext ? std::min (m_periods[1].start, now) : now;
+      bool ongoing = (last == now);
+
+      if (last > first)
+        {
+          double seconds = (last - first).GetSeconds ();
+          if (period.state == SWITCH_STATE)
+            {
+              conso += period.switchPower * seconds;
+            }
+          else
+            {
+              conso += energy (period, seconds, ongoing);
+            }
+        }
+
+      if (ongoing)
+        {
+          break;
+        }
+      m_periods.pop_front ();
+    }
+
+  double average = conso / (now - m_lastUpdateTime).GetSeconds ();
+  m_lastUpdateTime = now;
+  return average;
+}
+
+} // namespace ns3
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef STATE_TIMELINE_H_
+#define STATE_TIMELINE_H_
+
+#include <deque>
+#include <vector>
+#include "ns3/callback.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup energy
+ *
+ * \brief Timeline of the states of a node or net device energy model.
+ *
+ * Stores the pending state periods (state 0 = off, 1 = on, 2 = switching,
+ * others defined by the model) in a deque so that consumed periods are
+ * released in O(1). GetAveragePower integrates the energy spent over
+ * [lastUpdate, now] and drops every period that ended before now.
+ */
+class StateTimeline
+{
+public:
+  /**
+   * A period of the timeline, starting at \c start and lasting until the
+   * start of the next one.
+   */
+  struct Period
+  {
+    Time start;
+    uint32_t state;
+    double switchPower; //!< Power (W) drawn while switching, only for state 2
+    uint64_t rate; //!< Data rate (bps) of the period, 0 for models not adapting it
+    std::vector<double> counters; //!< Model specific counters recorded for the period
+  };
+
+  /**
+   * Energy (J) spent during \c seconds of a non-switching period. The last
+   * argument is true when the period is still ongoing.
+   */
+  typedef Callback<double, const Period &, double, bool> EnergyCallback;
+
+  /**
+   * Instantaneous power (W) of a non-switching state.
+   */
+  typedef Callback<double, uint32_t> PowerCallback;
+
+  StateTimeline ();
+
+  /**
+   * Drop every period and restart the timeline at t=0 in the given state.
+   *
+   * \param state Initial state.
+   * \param rate Initial data rate (bps), if the model adapts it.
+   */
+  void Reset (uint32_t state, uint64_t rate = 0);
+
+  /**
+   * \returns The state of the last period of the timeline.
+   */
+  uint32_t GetLastState (void) const;
+
+  /**
+   * \returns The number of pending periods.
+   */
+  uint32_t GetNPeriods (void) const;
+
+  /**
+   * Record a state switch happening now. Periods still scheduled after now
+   * are discarded.
+   *
+   * \param state New state, reached at Now () + duration.
+   * \param energy Energy consumed by the state switch.
+   * \param duration Duration of the state switch.
+   * \param rate Data rate (bps) from the switch on, if the model adapts it.
+   */
+  void Update (uint32_t state, double energy, Time duration, uint64_t rate = 0);
+
+  /**
+   * Accumulate model specific counters (e.g. bytes sent) into the period
+   * active at Now ().
+   *
+   * \param counters Values to add.
+   */
+  void Record (const std::vector<double> &counters);
+
+  /**
+   * Integrate the energy consumed since the previous call.
+   *
+   * \param energy Energy of a non-switching period.
+   * \param power Instantaneous power of a non-switching state.
+   *
+   * \returns The average power (W) over [lastUpdate, now], or the
+   * instantaneous power when no time has elapsed.
+   */
+  double GetAveragePower (EnergyCallback energy, PowerCallback power);
+
+private:
+  std::deque<Period> m_periods;
+  Time m_lastUpdateTime;
+};
+
+} // namespace ns3
+
+#endif /* STATE_TIMELINE_H_ */
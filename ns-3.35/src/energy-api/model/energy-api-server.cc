@@ -0,0 +1,395 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "energy-api-server.h"
+#include "energy-api.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <vector>
+#include "unistd.h"
+#include "poll.h"
+#include "arpa/inet.h"
+#include "netinet/in.h"
+#include "netinet/tcp.h"
+#include "sys/socket.h"
+#include "sys/un.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("EnergyAPIServer");
+
+static const int POLL_TIMEOUT_MS = 100;
+
+static const char *
+Reason (int status)
+{
+  switch (status)
+    {
+    case 200:
+      return "OK";
+    case 400:
+      return "Bad Request";
+    case 405:
+      return "Method Not Allowed";
+    default:
+      return "Not Found";
+    }
+}
+
+static std::string
+Response (int status, const std::string &body)
+{
+  std::ostringstream os;
+  os << "HTTP/1.1 " << status << " " << Reason (status) << "\r\n"
+     << "Content-Type: application/json\r\n";
+  if (status == 405)
+    os << "Allow: GET\r\n";
+  os << "Content-Length: " << body.size () << "\r\n\r\n" << body;
+  return os.str ();
+}
+
+/**
+ * JSON string literal of str, control characters included.
+ */
+static std::string
+Quote (const std::string &str)
+{
+  std::string quoted = "\"";
+  for (char c : str)
+    {
+      if (c == '"' || c == '\\')
+        {
+          quoted += '\\';
+          quoted += c;
+        }
+      else if (static_cast<unsigned char> (c) < 0x20)
+        {
+          char escaped[7];
+          snprintf (escaped, sizeof (escaped), "\\u%04x", c);
+          quoted += escaped;
+        }
+      else
+        quoted += c;
+    }
+  return quoted + "\"";
+}
+
+static std::string
+Error (int status, const std::string &message)
+{
+  return Response (status, "{\"error\": " + Quote (message) + "}");
+}
+
+static std::map<std::string, std::string>
+ParseQuery (const std::string &query)
+{
+  std::map<std::string, std::string> params;
+  std::istringstream is (query);
+  std::string param;
+  while (std::getline (is, param, '&'))
+    {
+      size_t eq = param.find ('=');
+      if (eq != std::string::npos)
+        params[param.substr (0, eq)] = param.substr (eq + 1);
+    }
+  return params;
+}
+
+/**
+ * Read a time in seconds, "now" being the current simulated time.
+ */
+static bool
+ParseTime (const std::string &value, Time &t)
+{
+  if (value == "now")
+    {
+      t = Simulator::Now ();
+      return true;
+    }
+  char *end;
+  double seconds = strtod (value.c_str (), &end);
+  // Times past Time::Max () do not fit the int64 Time
+  if (value.empty () || *end != '\0' || !std::isfinite (seconds) || seconds < 0 ||
+      seconds >= Time::Max ().GetSeconds ())
+    return false;
+  t = Seconds (seconds);
+  return true;
+}
+
+static void
+WriteValues (std::ostream &os, const TimeSeries &series)
+{
+  os << "[";
+  for (size_t i = 0; i < series.GetSize (); i++)
+    os << (i ? ", " : "") << series.GetData ()[i];
+  os << "]";
+}
+
+EnergyAPIServer::EnergyAPIServer (std::string address) : m_address (address), m_stop (false)
+{
+  if (address.compare (0, 5, "unix:") == 0)
+    {
+      struct sockaddr_un addr;
+      std::string path = address.substr (5);
+      NS_ABORT_MSG_IF (path.size () >= sizeof (addr.sun_path),
+                       "EnergyAPIServer: socket path too long " << path);
+      memset (&addr, 0, sizeof (addr));
+      addr.sun_family = AF_UNIX;
+      strncpy (addr.sun_path, path.c_str (), sizeof (addr.sun_path) - 1);
+      unlink (path.c_str ());
+
+      m_listenFd = socket (AF_UNIX, SOCK_STREAM, 0);
+      NS_ABORT_MSG_IF (m_listenFd == -1 ||
+                           bind (m_listenFd, (struct sockaddr *) &addr, sizeof (addr)) == -1,
+                       "EnergyAPIServer: cannot bind " << address);
+    }
+  else
+    {
+      struct sockaddr_in addr;
+      size_t colon = address.rfind (':');
+      NS_ABORT_MSG_IF (colon == std::string::npos,
+                       "EnergyAPIServer: expected host:port or unix:path, got " << address);
+      std::string host = address.substr (0, colon);
+      if (host == "localhost")
+        host = "127.0.0.1";
+      memset (&addr, 0, sizeof (addr));
+      addr.sin_family = AF_INET;
+      addr.sin_port = htons (std::stoi (address.substr (colon + 1)));
+      NS_ABORT_MSG_IF (inet_pton (AF_INET, host.c_str (), &addr.sin_addr) != 1,
+                       "EnergyAPIServer: invalid host " << host);
+
+      m_listenFd = socket (AF_INET, SOCK_STREAM, 0);
+      int one = 1;
+      setsockopt (m_listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof (one));
+      NS_ABORT_MSG_IF (m_listenFd == -1 ||
+                           bind (m_listenFd, (struct sockaddr *) &addr, sizeof (addr)) == -1,
+                       "EnergyAPIServer: cannot bind " << address);
+    }
+
+  NS_ABORT_MSG_IF (listen (m_listenFd, SOMAXCONN) == -1,
+                   "EnergyAPIServer: cannot listen on " << address);
+  NS_LOG_INFO ("EnergyAPI server listening on " << address);
+
+  m_thread = Create<SystemThread> (MakeCallback (&EnergyAPIServer::Run, this));
+  m_thread->Start ();
+}
+
+EnergyAPIServer::~EnergyAPIServer ()
+{
+  Stop ();
+}
+
+void
+EnergyAPIServer::Stop (void)
+{
+  if (m_thread == 0)
+    return;
+
+  m_stop = true;
+  m_thread->Join ();
+  m_thread = 0;
+
+  for (auto &client : m_clients)
+    close (client.first);
+  m_clients.clear ();
+  close (m_listenFd);
+  if (m_address.compare (0, 5, "unix:") == 0)
+    unlink (m_address.substr (5).c_str ());
+}
+
+void
+EnergyAPIServer::Run (void)
+{
+  std::vector<struct pollfd> fds;
+  while (!m_stop)
+    {
+      fds.clear ();
+      fds.push_back ({m_listenFd, POLLIN, 0});
+      for (auto &client : m_clients)
+        fds.push_back ({client.first, POLLIN, 0});
+
+      if (poll (fds.data (), fds.size (), POLL_TIMEOUT_MS) <= 0)
+        continue;
+
+      if (fds[0].revents & POLLIN)
+        {
+          int fd = accept (m_listenFd, NULL, NULL);
+          if (fd != -1)
+            {
+              int one = 1;
+              setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof (one));
+              m_clients[fd] = "";
+            }
+        }
+
+      for (size_t i = 1; i < fds.size (); i++)
+        {
+          if (fds[i].revents & (POLLIN | POLLHUP | POLLERR))
+            Receive (fds[i].fd);
+        }
+    }
+}
+
+void
+EnergyAPIServer::Receive (int fd)
+{
+  char buffer[4096];
+  ssize_t n = recv (fd, buffer, sizeof (buffer), 0);
+  if (n <= 0)
+    {
+      close (fd);
+      m_clients.erase (fd);
+      return;
+    }
+
+  std::string &input = m_clients[fd];
+  input.append (buffer, n);
+
+  // Requests carry no body, each one ends with an empty line
+  size_t end;
+  while ((end = input.find ("\r\n\r\n")) != std::string::npos)
+    {
+      std::string response = Handle (input.substr (0, end));
+      input.erase (0, end + 4);
+      if (response.empty () || send (fd, response.data (), response.size (), MSG_NOSIGNAL) == -1)
+        {
+          close (fd);
+          m_clients.erase (fd);
+          return;
+        }
+    }
+}
+
+std::string
+EnergyAPIServer::Handle (const std::string &request)
+{
+  std::istringstream is (request);
+  std::string method, target;
+  if (!(is >> method >> target))
+    return "";
+  if (method != "GET")
+    return Error (405, "unsupported method " + method);
+
+  size_t mark = target.find ('?');
+  std::string path = target.substr (0, mark);
+  std::string query = (mark == std::string::npos) ? "" : target.substr (mark + 1);
+
+  if (path == "/time")
+    {
+      std::ostringstream os;
+      os << "{\"time\": " << Simulator::Now ().GetSeconds () << "}";
+      return Response (200, os.str ());
+    }
+  if (path.compare (0, 5, "/flex") == 0)
+    return HandleSeries (true, path.substr (5), query);
+  if (path.compare (0, 9, "/estimate") == 0)
+    return HandleSeries (false, path.substr (9), query);
+
+  return Error (404, "unknown path " + path);
+}
+
+std::string
+EnergyAPIServer::HandleSeries (bool flex, const std::string &path, const std::string &query)
+{
+  std::map<std::string, std::string> params = ParseQuery (query);
+  std::ostringstream os;
+  os.precision (9);
+
+  Time t = Simulator::Now ();
+  bool at = params.count ("t");
+  if (at && !ParseTime (params["t"], t))
+    return Error (400, "invalid time " + params["t"]);
+
+  // Every series, whole or at t
+  if ((path.empty () || path == "/") && !params.count ("id"))
+    {
+      std::vector<std::string> names =
+          flex ? EnergyAPI::GetFlexNames () : EnergyAPI::GetEstimateNames ();
+      if (at)
+        os << "{\"time\": " << t.GetSeconds () << ", \"values\": {";
+      else
+        os << "{";
+      for (size_t i = 0; i < names.size (); i++)
+        {
+          EnergyAPI::SeriesId id =
+              flex ? EnergyAPI::GetFlexId (names[i]) : EnergyAPI::GetEstimateId (names[i]);
+          const TimeSeries &series = flex ? EnergyAPI::GetFlex (id) : EnergyAPI::GetEstimate (id);
+          os << (i ? ", " : "") << Quote (names[i]) << ": ";
+          if (at)
+            os << series.GetValue (t);
+          else
+            WriteValues (os, series);
+        }
+      os << (at ? "}}" : "}");
+      return Response (200, os.str ());
+    }
+
+  std::string name;
+  bool format = false;
+  if (path.empty () || path == "/")
+    name = params["id"];
+  else
+    {
+      name = path.substr (1);
+      size_t slash = name.find ('/');
+      if (slash != std::string::npos)
+        {
+          if (name.substr (slash) != "/series")
+            return Error (404, "unknown path " + path);
+          name = name.substr (0, slash);
+          format = true;
+        }
+    }
+
+  if (flex ? !EnergyAPI::HasFlex (name) : !EnergyAPI::HasEstimate (name))
+    return Error (404, "unknown series " + name);
+  EnergyAPI::SeriesId id = flex ? EnergyAPI::GetFlexId (name) : EnergyAPI::GetEstimateId (name);
+  const TimeSeries &series = flex ? EnergyAPI::GetFlex (id) : EnergyAPI::GetEstimate (id);
+
+  if (format)
+    {
+      os << "{\"id\": " << Quote (name) << ", \"start\": " << series.GetStart ().GetSeconds ()
+         << ", \"step\": " << series.GetStep ().GetSeconds () << ", \"boundary\": "
+         << (series.GetBoundary () == TimeSeries::WRAP ? "\"wrap\"" : "\"hold\"")
+         << ", \"interpolation\": "
+         << (series.GetInterpolation () == TimeSeries::STEP ? "\"step\"" : "\"linear\"")
+         << ", \"values\": ";
+      WriteValues (os, series);
+      os << "}";
+    }
+  else if (path.empty () || path == "/")
+    {
+      // Same answer as the former Flask server
+      os << "{" << Quote (name) << ": ";
+      WriteValues (os, series);
+      os << "}";
+    }
+  else
+    os << "{\"id\": " << Quote (name) << ", \"time\": " << t.GetSeconds ()
+       << ", \"value\": " << series.GetValue (t) << "}";
+
+  return Response (200, os.str ());
+}
+
+} // namespace ns3
@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef ENERGY_API_SERVER_H
+#define ENERGY_API_SERVER_H
+
+#include <atomic>
+#include <map>
+#include <string>
+#include "ns3/simple-ref-count.h"
+#include "ns3/system-thread.h"
+
+namespace ns3 {
+
+/**
+ * \brief HTTP/JSON server answering EnergyAPI queries from a thread of the
+ * simulator.
+ *
+ * Listens on "host:port" or "unix:path" and serves, for the flex and the
+ * estimate series:
+ *
+ * - GET /time: the current simulated time
+ * - GET /flex: every series, as an object of arrays
+ * - GET /flex?id=<id>: a single series, as {id: array}
+ * - GET /flex?t=<seconds|now>: the value of every series at t
+ * - GET /flex/<id>[?t=<seconds|now>]: the value of a series at t (default now)
+ * - GET /flex/<id>/series: the format and values of a series
+ *
+ * (and the same under /estimate). Values are read straight from the
+ * EnergyAPI series, which must not be modified while the server runs. The
+ * current time is read through Simulator::Now, which only the
+ * RealtimeSimulatorImpl locks against the simulation thread.
+ */
+class EnergyAPIServer : public SimpleRefCount<EnergyAPIServer>
+{
+public:
+  /**
+   * Bind the address, aborts if it cannot, and start the server thread.
+   */
+  EnergyAPIServer (std::string address);
+  ~EnergyAPIServer ();
+
+  /**
+   * Stop the server thread and close every connection.
+   */
+  void Stop (void);
+
+private:
+  void Run (void);
+  void Receive (int fd);
+
+  /**
+   * \returns The response to a request, empty if the request is malformed.
+   */
+  std::string Handle (const std::string &request);
+  std::string HandleSeries (bool flex, const std::string &path, const std::string &query);
+
+  std::string m_address;
+  int m_listenFd;
+  std::map<int, std::string> m_clients; //!< Pending input of each connection
+  std::atomic<bool> m_stop;
+  Ptr<SystemThread> m_thread;
+};
+
+} // namespace ns3
+
+#endif /* ENERGY_API_SERVER_H */
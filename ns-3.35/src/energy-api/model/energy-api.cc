@@ -20,10 +20,10 @@
  * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
  */
 
+#include <cmath>
 #include "energy-api.h"
-#include "fcntl.h"
-#include "signal.h"
-#include "unistd.h"
+#include "energy-api-server.h"
+#include "ns3/realtime-simulator-impl.h"
 
 namespace ns3 {
 
@@ -31,9 +31,22 @@ using namespace std;
 
 NS_OBJECT_ENSURE_REGISTERED (EnergyAPI);
 
-map<string, vector<float>> EnergyAPI::m_flexes = map<string, vector<float>> ();
-map<string, vector<float>> EnergyAPI::m_estimates = map<string, vector<float>> ();
-pid_t EnergyAPI::m_pid = 0;
+EnergyAPI::SeriesPool EnergyAPI::m_flexes = {"flex", {}, {}, {}, {}};
+EnergyAPI::SeriesPool EnergyAPI::m_estimates = {"estimate", {}, {}, {}, {}};
+map<string, EnergyAPI::RegionId> EnergyAPI::m_regionIds = map<string, RegionId> ();
+vector<string> EnergyAPI::m_regionNames = vector<string> ();
+vector<EnergyAPI::RegionId> EnergyAPI::m_nodeRegions = vector<RegionId> ();
+map<uint32_t, EnergyAPI::Subscription> EnergyAPI::m_subscriptions =
+    map<uint32_t, Subscription> ();
+uint32_t EnergyAPI::m_nextSubscription = 0;
+Ptr<EnergyAPIServer> EnergyAPI::m_server = 0;
+
+static GlobalValue g_EnergyAPIAddress =
+    GlobalValue ("EnergyAPIAddress",
+                 "Address served by the EnergyAPI server, host:port or unix:path",
+                 StringValue ("127.0.0.1:5000"), MakeStringChecker ());
+
+static const EnergyAPI::RegionId NO_REGION = UINT32_MAX;
 
 TypeId
 EnergyAPI::GetTypeId (void)
@@ -48,84 +61,391 @@ EnergyAPI::EnergyAPI ()
 
 EnergyAPI::~EnergyAPI ()
 {
-  StopExternalServer ();
+  StopServer ();
+}
+
+EnergyAPI::SeriesView::SeriesView (const float *data, size_t size) : m_data (data), m_size (size)
+{
+}
+
+const float *
+EnergyAPI::SeriesView::begin () const
+{
+  return m_data;
+}
+
+const float *
+EnergyAPI::SeriesView::end () const
+{
+  return m_data + m_size;
+}
+
+size_t
+EnergyAPI::SeriesView::size () const
+{
+  return m_size;
+}
+
+float
+EnergyAPI::SeriesView::operator[] (size_t i) const
+{
+  return m_data[i];
+}
+
+float
+EnergyAPI::SeriesView::At (size_t i) const
+{
+  NS_ABORT_MSG_IF (i >= m_size,
+                   "EnergyAPI: index " << i << " out of range of a " << m_size << " values series");
+  return m_data[i];
+}
+
+EnergyAPI::SeriesId
+EnergyAPI::Register (SeriesPool &pool, string id, TimeSeries series)
+{
+  auto it = pool.ids.find (id);
+  if (it != pool.ids.end ())
+    {
+      pool.values[it->second].clear ();
+      pool.series[it->second] = series;
+      return it->second;
+    }
+
+  SeriesId handle = pool.series.size ();
+  pool.ids[id] = handle;
+  pool.values.push_back (vector<float> ());
+  pool.series.push_back (series);
+  return handle;
+}
+
+void
+EnergyAPI::Add (SeriesPool &pool, string id, vector<float> &arr, TimeSeries format)
+{
+  SeriesId handle = Register (pool, id, format);
+  pool.values[handle].swap (arr);
+  pool.series[handle].SetValues (pool.values[handle].data (), pool.values[handle].size ());
+}
+
+void
+EnergyAPI::Load (SeriesPool &pool, string path)
+{
+  Ptr<SeriesFile> file = Create<SeriesFile> (path);
+  for (uint32_t i = 0; i < file->GetN (); i++)
+    Register (pool, file->GetName (i), file->Get (i));
+  pool.files.push_back (file);
+}
+
+EnergyAPI::SeriesId
+EnergyAPI::Find (const SeriesPool &pool, string id)
+{
+  auto it = pool.ids.find (id);
+  NS_ABORT_MSG_IF (it == pool.ids.end (), "EnergyAPI: unknown " << pool.name << " series " << id);
+  return it->second;
 }
 
-vector<float>
+const TimeSeries &
+EnergyAPI::Get (const SeriesPool &pool, SeriesId id)
+{
+  NS_ABORT_MSG_IF (id >= pool.series.size (),
+                   "EnergyAPI: unknown " << pool.name << " series handle " << id);
+  return pool.series[id];
+}
+
+void
+EnergyAPI::Gather (const SeriesPool &pool, const vector<SeriesId> &ids, Time t,
+                   vector<float> &values)
+{
+  values.resize (ids.size ());
+  for (size_t i = 0; i < ids.size (); i++)
+    values[i] = Get (pool, ids[i]).GetValue (t);
+}
+
+Time
+EnergyAPI::NextChange (const SeriesPool &pool, const vector<SeriesId> &ids, Time t)
+{
+  Time next = Time::Max ();
+  for (SeriesId id : ids)
+    next = Min (next, Get (pool, id).GetNextChange (t));
+  return next;
+}
+
+EnergyAPI::SeriesView
 EnergyAPI::GetFlexArray (string id)
 {
-  // TODO: Check if id exists
-  return m_flexes[id];
+  return GetFlexSeries (Find (m_flexes, id));
 }
 
-vector<float>
+EnergyAPI::SeriesView
 EnergyAPI::GetEstimateArray (string id)
 {
-  // TODO: Check if id exists
-  return m_estimates[id];
+  return GetEstimateSeries (Find (m_estimates, id));
+}
+
+void
+EnergyAPI::AddFlexArray (string id, vector<float> arr, TimeSeries format)
+{
+  Add (m_flexes, id, arr, format);
+}
+
+void
+EnergyAPI::AddEstimateArray (string id, vector<float> arr, TimeSeries format)
+{
+  Add (m_estimates, id, arr, format);
 }
 
 void
-EnergyAPI::AddFlexArray (string id, vector<float> arr)
+EnergyAPI::LoadFlexFile (string path)
+{
+  Load (m_flexes, path);
+}
+
+void
+EnergyAPI::LoadEstimateFile (string path)
+{
+  Load (m_estimates, path);
+}
+
+EnergyAPI::SeriesId
+EnergyAPI::GetFlexId (string id)
+{
+  return Find (m_flexes, id);
+}
+
+EnergyAPI::SeriesId
+EnergyAPI::GetEstimateId (string id)
+{
+  return Find (m_estimates, id);
+}
+
+bool
+EnergyAPI::HasFlex (string id)
+{
+  return m_flexes.ids.count (id);
+}
+
+bool
+EnergyAPI::HasEstimate (string id)
+{
+  return m_estimates.ids.count (id);
+}
+
+uint32_t
+EnergyAPI::Subscribe (const SeriesPool &pool, const vector<SeriesId> &ids, ChangeCallback callback,
+                      double threshold)
 {
-  m_flexes[id] = arr;
+  uint32_t subscription = m_nextSubscription++;
+  Subscription &sub = m_subscriptions[subscription];
+  sub.pool = &pool;
+  sub.ids = ids;
+  sub.callback = callback;
+  sub.threshold = threshold;
+  Gather (pool, ids, Simulator::Now (), sub.values);
+  ScheduleNotify (subscription);
+  return subscription;
 }
 
 void
-EnergyAPI::AddEstimateArray (string id, vector<float> arr)
+EnergyAPI::ScheduleNotify (uint32_t subscription)
 {
-  m_estimates[id] = arr;
+  Subscription &sub = m_subscriptions[subscription];
+  Time now = Simulator::Now ();
+  Time next = NextChange (*sub.pool, sub.ids, now);
+  if (next != Time::Max ())
+    sub.event = Simulator::Schedule (next - now, &EnergyAPI::Notify, subscription);
 }
 
 void
-EnergyAPI::StartExternalServer (string topoName, string estiFile, string flexFile)
+EnergyAPI::Notify (uint32_t subscription)
 {
-  if (m_pid != 0)
-    NS_ABORT_MSG ("External EnergyAPI server already running");
+  Subscription &sub = m_subscriptions[subscription];
+  Time now = Simulator::Now ();
+  vector<SeriesId> changed;
+  for (size_t i = 0; i < sub.ids.size (); i++)
+    {
+      float value = Get (*sub.pool, sub.ids[i]).GetValue (now);
+      if (std::abs (value - sub.values[i]) > sub.threshold)
+        {
+          sub.values[i] = value;
+          changed.push_back (sub.ids[i]);
+        }
+    }
 
-  pid_t pid = fork ();
-  NS_ABORT_MSG_IF (pid == -1, "EnergyAPI: fork() failed");
-  if (pid == 0)
+  ScheduleNotify (subscription);
+  if (!changed.empty ())
     {
-      std::string outPath = SystemPath::Append (topoName, "energyAPI.out");
-      int outfd = open (outPath.c_str (), O_WRONLY | O_CREAT, 0666);
-      close (STDOUT_FILENO);
-      close (STDERR_FILENO);
-      dup2 (outfd, STDOUT_FILENO);
-      dup2 (outfd, STDERR_FILENO);
-
-      list<string> paths = ns3::SystemPath::Split (ns3::SystemPath::FindSelfDirectory ());
-      paths.erase (std::prev (paths.end (), 2), paths.end ());
-
-      list<string> executablePaths = {"utils", "energy-api-server.py"};
-      std::copy (paths.rbegin (), paths.rend (), std::front_inserter (executablePaths));
-      std::string executable =
-          ns3::SystemPath::Join (executablePaths.begin (), executablePaths.end ());
-
-      paths.erase (std::prev (paths.end ()), paths.end ());
-      list<string> topoPaths = {"topologies", topoName};
-      std::copy (paths.rbegin (), paths.rend (), std::front_inserter (topoPaths));
-      std::string topo = ns3::SystemPath::Join (topoPaths.begin (), topoPaths.end ());
-      string esti = SystemPath::Append (topo, estiFile);
-      string flex = SystemPath::Append (topo, flexFile);
-
-      int st = execl (executable.c_str (), executable.c_str (), "-e", esti.c_str (), "-f",
-                      flex.c_str (), NULL);
-      NS_ABORT_MSG ("EnergyAPI: execl failed with status " << st);
+      // The callback may unsubscribe, erasing sub
+      ChangeCallback callback = sub.callback;
+      callback (changed);
     }
+}
+
+uint32_t
+EnergyAPI::SubscribeFlex (const vector<SeriesId> &ids, ChangeCallback callback, double threshold)
+{
+  return Subscribe (m_flexes, ids, callback, threshold);
+}
+
+uint32_t
+EnergyAPI::SubscribeEstimate (const vector<SeriesId> &ids, ChangeCallback callback,
+                              double threshold)
+{
+  return Subscribe (m_estimates, ids, callback, threshold);
+}
+
+void
+EnergyAPI::Unsubscribe (uint32_t subscription)
+{
+  auto it = m_subscriptions.find (subscription);
+  NS_ABORT_MSG_IF (it == m_subscriptions.end (),
+                   "EnergyAPI: unknown subscription " << subscription);
+  it->second.event.Cancel ();
+  m_subscriptions.erase (it);
+}
+
+void
+EnergyAPI::SetNodeRegion (uint32_t nodeId, string region)
+{
+  auto it = m_regionIds.find (region);
+  RegionId regionId;
+  if (it != m_regionIds.end ())
+    regionId = it->second;
   else
     {
-      m_pid = pid;
+      regionId = m_regionNames.size ();
+      m_regionIds[region] = regionId;
+      m_regionNames.push_back (region);
     }
+
+  if (nodeId >= m_nodeRegions.size ())
+    m_nodeRegions.resize (nodeId + 1, NO_REGION);
+  m_nodeRegions[nodeId] = regionId;
+}
+
+EnergyAPI::RegionId
+EnergyAPI::GetNodeRegion (uint32_t nodeId)
+{
+  NS_ABORT_MSG_IF (nodeId >= m_nodeRegions.size () || m_nodeRegions[nodeId] == NO_REGION,
+                   "EnergyAPI: node " << nodeId << " has no energy region");
+  return m_nodeRegions[nodeId];
+}
+
+uint32_t
+EnergyAPI::GetNRegions (void)
+{
+  return m_regionNames.size ();
+}
+
+string
+EnergyAPI::GetRegionName (RegionId region)
+{
+  NS_ABORT_MSG_IF (region >= m_regionNames.size (), "EnergyAPI: unknown region " << region);
+  return m_regionNames[region];
+}
+
+EnergyAPI::SeriesId
+EnergyAPI::GetRegionFlexId (RegionId region)
+{
+  return Find (m_flexes, GetRegionName (region));
+}
+
+EnergyAPI::SeriesId
+EnergyAPI::GetRegionEstimateId (RegionId region)
+{
+  return Find (m_estimates, GetRegionName (region));
+}
+
+EnergyAPI::SeriesView
+EnergyAPI::GetFlexSeries (SeriesId id)
+{
+  const TimeSeries &series = Get (m_flexes, id);
+  return SeriesView (series.GetData (), series.GetSize ());
+}
+
+EnergyAPI::SeriesView
+EnergyAPI::GetEstimateSeries (SeriesId id)
+{
+  const TimeSeries &series = Get (m_estimates, id);
+  return SeriesView (series.GetData (), series.GetSize ());
+}
+
+const TimeSeries &
+EnergyAPI::GetFlex (SeriesId id)
+{
+  return Get (m_flexes, id);
+}
+
+const TimeSeries &
+EnergyAPI::GetEstimate (SeriesId id)
+{
+  return Get (m_estimates, id);
+}
+
+void
+EnergyAPI::GetFlexValues (const vector<SeriesId> &ids, Time t, vector<float> &values)
+{
+  Gather (m_flexes, ids, t, values);
+}
+
+void
+EnergyAPI::GetEstimateValues (const vector<SeriesId> &ids, Time t, vector<float> &values)
+{
+  Gather (m_estimates, ids, t, values);
+}
+
+Time
+EnergyAPI::GetNextFlexChange (const vector<SeriesId> &ids, Time t)
+{
+  return NextChange (m_flexes, ids, t);
+}
+
+Time
+EnergyAPI::GetNextEstimateChange (const vector<SeriesId> &ids, Time t)
+{
+  return NextChange (m_estimates, ids, t);
+}
+
+vector<string>
+EnergyAPI::GetFlexNames (void)
+{
+  return Names (m_flexes);
+}
+
+vector<string>
+EnergyAPI::GetEstimateNames (void)
+{
+  return Names (m_estimates);
+}
+
+vector<string>
+EnergyAPI::Names (const SeriesPool &pool)
+{
+  vector<string> names;
+  names.reserve (pool.ids.size ());
+  for (auto &id : pool.ids)
+    names.push_back (id.first);
+  return names;
+}
+
+void
+EnergyAPI::StartServer (void)
+{
+  NS_ABORT_MSG_IF (m_server != 0, "EnergyAPI server already running");
+  // The server thread reads the simulated time, only the realtime simulator locks it
+  NS_ABORT_MSG_IF (!DynamicCast<RealtimeSimulatorImpl> (Simulator::GetImplementation ()),
+                   "EnergyAPI server requires the ns3::RealtimeSimulatorImpl simulator");
+
+  StringValue address;
+  GlobalValue::GetValueByName ("EnergyAPIAddress", address);
+  m_server = Create<EnergyAPIServer> (address.Get ());
 }
 
 void
-EnergyAPI::StopExternalServer ()
+EnergyAPI::StopServer (void)
 {
-  if (m_pid > 0)
+  if (m_server != 0)
     {
-      kill (m_pid, SIGKILL);
-      m_pid = 0;
+      m_server->Stop ();
+      m_server = 0;
     }
 }
 
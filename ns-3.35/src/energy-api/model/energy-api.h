@@ -24,32 +24,207 @@
 #define ENERGY_API_H
 
 #include "ns3/core-module.h"
+#include "time-series.h"
+#include "series-file.h"
 
 namespace ns3 {
 
 using namespace std;
 
+class EnergyAPIServer;
+
 class EnergyAPI : public Object
 {
 
 public:
+  /**
+   * Handle of a flex or estimate series, resolved once from its id.
+   */
+  typedef uint32_t SeriesId;
+
+  /**
+   * Handle of an energy region, a set of nodes sharing the same flex and
+   * estimate series, named after the region.
+   */
+  typedef uint32_t RegionId;
+
+  /**
+   * Called with the subscribed series that changed.
+   */
+  typedef Callback<void, const vector<SeriesId> &> ChangeCallback;
+
+  /**
+   * Read-only view over the values of a series, without copies. It stays
+   * valid until the series is replaced.
+   */
+  class SeriesView
+  {
+  public:
+    SeriesView (const float *data, size_t size);
+
+    const float *begin () const;
+    const float *end () const;
+    size_t size () const;
+    float operator[] (size_t i) const;
+
+    /**
+     * Bounds-checked access, aborts when i is out of range.
+     */
+    float At (size_t i) const;
+
+  private:
+    const float *m_data;
+    size_t m_size;
+  };
+
   static TypeId GetTypeId (void);
   EnergyAPI ();
   ~EnergyAPI ();
 
-  static vector<float> GetFlexArray (string id);
-  static vector<float> GetEstimateArray (string id);
+  static SeriesView GetFlexArray (string id);
+  static SeriesView GetEstimateArray (string id);
+
+  /**
+   * Add (or replace) a series. The format gives its start, step and
+   * behaviour past the horizon, by default one value per minute from t=0,
+   * wrapping around.
+   */
+  static void AddFlexArray (string id, vector<float> arr, TimeSeries format = TimeSeries ());
+  static void AddEstimateArray (string id, vector<float> arr, TimeSeries format = TimeSeries ());
+
+  /**
+   * Map a binary series file (see SeriesFile) and serve its series straight
+   * from the mapping. Series already added with the same id are replaced.
+   */
+  static void LoadFlexFile (string path);
+  static void LoadEstimateFile (string path);
+
+  /**
+   * Resolve a series id, aborts if it is unknown.
+   */
+  static SeriesId GetFlexId (string id);
+  static SeriesId GetEstimateId (string id);
+
+  static bool HasFlex (string id);
+  static bool HasEstimate (string id);
+
+  /**
+   * Assign a node to an energy region, created if needed. A node without
+   * an explicit region is alone in a region named after it.
+   */
+  static void SetNodeRegion (uint32_t nodeId, string region);
+
+  /**
+   * \returns The region of a node, aborts if the node has none.
+   */
+  static RegionId GetNodeRegion (uint32_t nodeId);
 
-  static void AddFlexArray (string id, vector<float> arr);
-  static void AddEstimateArray (string id, vector<float> arr);
+  static uint32_t GetNRegions (void);
+  static string GetRegionName (RegionId region);
 
-  static void StartExternalServer (string topoName, string estiFile, string flexFile);
-  static void StopExternalServer ();
+  /**
+   * Resolve the series of a region, aborts if it is unknown.
+   */
+  static SeriesId GetRegionFlexId (RegionId region);
+  static SeriesId GetRegionEstimateId (RegionId region);
+
+  static SeriesView GetFlexSeries (SeriesId id);
+  static SeriesView GetEstimateSeries (SeriesId id);
+
+  static const TimeSeries &GetFlex (SeriesId id);
+  static const TimeSeries &GetEstimate (SeriesId id);
+
+  /**
+   * Gather the values of the given series at time t, values[i] being the
+   * value of ids[i].
+   */
+  static void GetFlexValues (const vector<SeriesId> &ids, Time t, vector<float> &values);
+  static void GetEstimateValues (const vector<SeriesId> &ids, Time t, vector<float> &values);
+
+  /**
+   * \returns The first time after t at which one of the given series
+   * changes, or Time::Max () if none does.
+   */
+  static Time GetNextFlexChange (const vector<SeriesId> &ids, Time t);
+  static Time GetNextEstimateChange (const vector<SeriesId> &ids, Time t);
+
+  /**
+   * Subscribe to the changes of a set of series. The callback is invoked
+   * at the change points of the series, with every series whose value moved
+   * by more than threshold since it was last notified (or subscribed).
+   * Changes of several series at the same time are batched in one call.
+   *
+   * \returns The subscription id, to unsubscribe.
+   */
+  static uint32_t SubscribeFlex (const vector<SeriesId> &ids, ChangeCallback callback,
+                                 double threshold = 0.0);
+  static uint32_t SubscribeEstimate (const vector<SeriesId> &ids, ChangeCallback callback,
+                                     double threshold = 0.0);
+  static void Unsubscribe (uint32_t subscription);
+
+  /**
+   * \returns The ids of every series, sorted.
+   */
+  static vector<string> GetFlexNames (void);
+  static vector<string> GetEstimateNames (void);
+
+  /**
+   * Serve the series over HTTP from a thread of the simulator, on the
+   * address given by the EnergyAPIAddress global value (see
+   * EnergyAPIServer). The series must be loaded beforehand, and the
+   * simulator must be the ns3::RealtimeSimulatorImpl one.
+   */
+  static void StartServer (void);
+  static void StopServer (void);
 
 private:
-  static map<string, vector<float>> m_flexes;
-  static map<string, vector<float>> m_estimates;
-  static pid_t m_pid;
+  /**
+   * Interned series: ids are resolved once to an index in values.
+   */
+  struct SeriesPool
+  {
+    string name;
+    map<string, SeriesId> ids;
+    vector<vector<float>> values; //!< Empty for mapped series
+    vector<TimeSeries> series; //!< Points to values or to a mapped file
+    vector<Ptr<SeriesFile>> files;
+  };
+
+  static SeriesId Register (SeriesPool &pool, string id, TimeSeries series);
+  static void Add (SeriesPool &pool, string id, vector<float> &arr, TimeSeries format);
+  static void Load (SeriesPool &pool, string path);
+  static SeriesId Find (const SeriesPool &pool, string id);
+  static const TimeSeries &Get (const SeriesPool &pool, SeriesId id);
+  static void Gather (const SeriesPool &pool, const vector<SeriesId> &ids, Time t,
+                      vector<float> &values);
+  static Time NextChange (const SeriesPool &pool, const vector<SeriesId> &ids, Time t);
+  static vector<string> Names (const SeriesPool &pool);
+
+  struct Subscription
+  {
+    const SeriesPool *pool;
+    vector<SeriesId> ids;
+    vector<float> values; //!< Last notified values
+    ChangeCallback callback;
+    double threshold;
+    EventId event;
+  };
+
+  static uint32_t Subscribe (const SeriesPool &pool, const vector<SeriesId> &ids,
+                             ChangeCallback callback, double threshold);
+  static void ScheduleNotify (uint32_t subscription);
+  static void Notify (uint32_t subscription);
+
+  static SeriesPool m_flexes;
+  static SeriesPool m_estimates;
+
+  static map<string, RegionId> m_regionIds;
+  static vector<string> m_regionNames;
+  static vector<RegionId> m_nodeRegions; //!< Region of each node, by node id
+
+  static map<uint32_t, Subscription> m_subscriptions;
+  static uint32_t m_nextSubscription;
+  static Ptr<EnergyAPIServer> m_server;
 };
 
 } // namespace ns3
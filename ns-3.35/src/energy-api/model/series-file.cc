@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "series-file.h"
+#include "ns3/abort.h"
+#include <cstring>
+#include <fstream>
+#include "fcntl.h"
+#include "unistd.h"
+#include "sys/mman.h"
+#include "sys/stat.h"
+
+namespace ns3 {
+
+static const char SERIES_FILE_MAGIC[8] = {'F', 'X', 'S', 'E', 'R', 'I', 'E', 'S'};
+static const uint32_t SERIES_FILE_VERSION = 1;
+
+SeriesFile::SeriesFile (std::string path) : m_path (path), m_data (0), m_size (0)
+{
+  int fd = open (path.c_str (), O_RDONLY);
+  NS_ABORT_MSG_IF (fd == -1, "SeriesFile: cannot open " << path);
+
+  struct stat st;
+  NS_ABORT_MSG_IF (fstat (fd, &st) == -1, "SeriesFile: cannot stat " << path);
+  m_size = st.st_size;
+  NS_ABORT_MSG_IF (m_size < sizeof (Header), "SeriesFile: " << path << " is truncated");
+
+  void *data = mmap (NULL, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+  NS_ABORT_MSG_IF (data == MAP_FAILED, "SeriesFile: cannot map " << path);
+  m_data = static_cast<const uint8_t *> (data);
+
+  const Header *header = reinterpret_cast<const Header *> (m_data);
+  NS_ABORT_MSG_IF (memcmp (header->magic, SERIES_FILE_MAGIC, sizeof (SERIES_FILE_MAGIC)),
+                   "SeriesFile: " << path << " is not a series file");
+  NS_ABORT_MSG_IF (header->version != SERIES_FILE_VERSION,
+                   "SeriesFile: unsupported version " << header->version << " in " << path);
+  NS_ABORT_MSG_IF (sizeof (Header) + header->nSeries * sizeof (Entry) > m_size ||
+                       header->namesOffset + header->namesSize > m_size,
+                   "SeriesFile: " << path << " is truncated");
+
+  for (uint32_t i = 0; i < header->nSeries; i++)
+    {
+      const Entry &entry = GetEntry (i);
+      NS_ABORT_MSG_IF (entry.valuesOffset % sizeof (float) ||
+                           entry.valuesOffset + entry.nValues * sizeof (float) > m_size ||
+                           entry.nameOffset + entry.nameLength > header->namesSize,
+                       "SeriesFile: series " << i << " of " << path << " is malformed");
+    }
+}
+
+SeriesFile::~SeriesFile ()
+{
+  munmap (const_cast<uint8_t *> (m_data), m_size);
+}
+
+bool
+SeriesFile::Probe (std::string path)
+{
+  char magic[sizeof (SERIES_FILE_MAGIC)];
+  std::ifstream file (path, std::ios::binary);
+  return file.read (magic, sizeof (magic)) &&
+         !memcmp (magic, SERIES_FILE_MAGIC, sizeof (SERIES_FILE_MAGIC));
+}
+
+uint32_t
+SeriesFile::GetN (void) const
+{
+  return reinterpret_cast<const Header *> (m_data)->nSeries;
+}
+
+const SeriesFile::Entry &
+SeriesFile::GetEntry (uint32_t i) const
+{
+  return reinterpret_cast<const Entry *> (m_data + sizeof (Header))[i];
+}
+
+std::string
+SeriesFile::GetName (uint32_t i) const
+{
+  const Header *header = reinterpret_cast<const Header *> (m_data);
+  const Entry &entry = GetEntry (i);
+  const char *names = reinterpret_cast<const char *> (m_data + header->namesOffset);
+  return std::string (names + entry.nameOffset, entry.nameLength);
+}
+
+TimeSeries
+SeriesFile::Get (uint32_t i) const
+{
+  const Entry &entry = GetEntry (i);
+  NS_ABORT_MSG_IF (entry.boundary > TimeSeries::HOLD || entry.interpolation > TimeSeries::LINEAR,
+                   "SeriesFile: series " << i << " of " << m_path << " has an unknown format");
+  TimeSeries series (NanoSeconds (entry.start), NanoSeconds (entry.step),
+                     TimeSeries::Boundary (entry.boundary),
+                     TimeSeries::Interpolation (entry.interpolation));
+  series.SetValues (reinterpret_cast<const float *> (m_data + entry.valuesOffset), entry.nValues);
+  return series;
+}
+
+} // namespace ns3
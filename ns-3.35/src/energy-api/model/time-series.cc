@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "time-series.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+
+TimeSeries::TimeSeries (Time start, Time step, Boundary boundary, Interpolation interpolation)
+    : m_start (start),
+      m_step (step),
+      m_boundary (boundary),
+      m_interpolation (interpolation),
+      m_data (0),
+      m_size (0)
+{
+  NS_ABORT_MSG_IF (!step.IsStrictlyPositive (), "TimeSeries: step must be positive");
+}
+
+void
+TimeSeries::SetValues (const float *data, size_t size)
+{
+  m_data = data;
+  m_size = size;
+  m_nextChange.clear ();
+}
+
+void
+TimeSeries::BuildChangeIndex (void) const
+{
+  if (m_nextChange.size () == m_size)
+    return;
+
+  m_nextChange.resize (m_size);
+  for (size_t i = m_size; i-- > 0;)
+    {
+      if (i + 1 == m_size)
+        m_nextChange[i] = m_size;
+      else
+        m_nextChange[i] = (m_data[i + 1] != m_data[i]) ? i + 1 : m_nextChange[i + 1];
+    }
+}
+
+Time
+TimeSeries::GetStart (void) const
+{
+  return m_start;
+}
+
+Time
+TimeSeries::GetStep (void) const
+{
+  return m_step;
+}
+
+TimeSeries::Boundary
+TimeSeries::GetBoundary (void) const
+{
+  return m_boundary;
+}
+
+TimeSeries::Interpolation
+TimeSeries::GetInterpolation (void) const
+{
+  return m_interpolation;
+}
+
+Time
+TimeSeries::GetHorizon (void) const
+{
+  return m_step * m_size;
+}
+
+size_t
+TimeSeries::GetSize (void) const
+{
+  return m_size;
+}
+
+const float *
+TimeSeries::GetData (void) const
+{
+  return m_data;
+}
+
+void
+TimeSeries::Locate (Time t, int64_t &index, Time &base) const
+{
+  base = m_start;
+  if (t < m_start)
+    {
+      index = -1;
+      return;
+    }
+
+  int64_t ticks = (t - m_start).GetTimeStep ();
+  index = ticks / m_step.GetTimeStep ();
+  if (m_boundary == WRAP)
+    {
+      int64_t repetition = index / m_size;
+      index -= repetition * m_size;
+      base += GetHorizon () * repetition;
+    }
+}
+
+float
+TimeSeries::GetValue (Time t) const
+{
+  NS_ABORT_MSG_IF (m_size == 0, "TimeSeries: no values");
+
+  int64_t i;
+  Time base;
+  Locate (t, i, base);
+  if (i < 0)
+    return m_data[0];
+  if (i >= (int64_t) m_size)
+    return m_data[m_size - 1];
+  if (m_interpolation == STEP)
+    return m_data[i];
+
+  size_t next = i + 1;
+  if (next == m_size)
+    {
+      if (m_boundary == HOLD)
+        return m_data[i];
+      next = 0;
+    }
+  Time offset = t - base - m_step * i;
+  double fraction = double (offset.GetTimeStep ()) / m_step.GetTimeStep ();
+  return m_data[i] + (m_data[next] - m_data[i]) * fraction;
+}
+
+Time
+TimeSeries::GetNextChange (Time t) const
+{
+  if (m_size == 0)
+    return Time::Max ();
+  BuildChangeIndex ();
+
+  int64_t i;
+  Time base;
+  Locate (t, i, base);
+  if (i >= (int64_t) m_size)
+    return Time::Max ();
+
+  bool before = (i < 0);
+  size_t k = before ? 0 : i;
+  size_t last = m_size - 1;
+  bool wrap = (m_boundary == WRAP);
+
+  if (m_interpolation == STEP)
+    {
+      if (m_nextChange[k] < m_size)
+        return base + m_step * m_nextChange[k];
+      if (!wrap)
+        return Time::Max ();
+      if (m_data[0] != m_data[k])
+        return base + GetHorizon ();
+      if (m_nextChange[0] < m_size)
+        return base + GetHorizon () + m_step * m_nextChange[0];
+      return Time::Max ();
+    }
+
+  // Linear interpolation: the value changes along every segment between two
+  // different samples, so the change points are the starts of these segments
+  // and every sample boundary while the value moves.
+  size_t next = (k == last) ? 0 : k + 1;
+  bool moving = (k < last || wrap) && m_data[k] != m_data[next];
+  if (moving)
+    return before ? m_start : base + m_step * (k + 1);
+  if (m_nextChange[k] < m_size)
+    return base + m_step * (m_nextChange[k] - 1);
+  if (!wrap)
+    return Time::Max ();
+  if (m_data[0] != m_data[last])
+    return base + m_step * last;
+  if (m_nextChange[0] < m_size)
+    return base + GetHorizon () + m_step * (m_nextChange[0] - 1);
+  return Time::Max ();
+}
+
+TimeSeries::Boundary
+TimeSeries::ParseBoundary (std::string name)
+{
+  if (name == "wrap")
+    return WRAP;
+  NS_ABORT_MSG_IF (name != "hold", "TimeSeries: unknown boundary " << name);
+  return HOLD;
+}
+
+TimeSeries::Interpolation
+TimeSeries::ParseInterpolation (std::string name)
+{
+  if (name == "step")
+    return STEP;
+  NS_ABORT_MSG_IF (name != "linear", "TimeSeries: unknown interpolation " << name);
+  return LINEAR;
+}
+
+} // namespace ns3
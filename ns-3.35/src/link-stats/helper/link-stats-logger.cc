@@ -25,13 +25,14 @@
 
 namespace ns3 {
 
-Ptr<OutputStreamWrapper> LinkStatsLogger::m_streamWrapper = NULL;
+Ptr<TraceWriter> LinkStatsLogger::m_writer = NULL;
 ChannelContainer LinkStatsLogger::m_links = ChannelContainer ();
 ChannelContainer LinkStatsLogger::m_linksLog = ChannelContainer ();
+std::vector<uint32_t> LinkStatsLogger::m_entities = std::vector<uint32_t> ();
 
 LinkStatsLogger::LinkStatsLogger ()
 {
-  m_streamWrapper = 0;
+  m_writer = 0;
 }
 
 LinkStatsLogger::~LinkStatsLogger ()
@@ -44,16 +45,27 @@ LinkStatsLogger::ComputeStats (Time interval, Time stop, Ptr<Channel> channel)
   Time i = Seconds (0.0);
   while (i <= stop)
     {
-      Simulator::Schedule (i, &Channel::UpdateUsage, channel);
+      Simulator::Schedule (i, &LinkStatsLogger::UpdateUsage, channel);
       i += interval;
     }
 }
 
+void
+LinkStatsLogger::UpdateUsage (Ptr<Channel> channel)
+{
+  Ptr<LinkStats> ls = channel->GetObject<LinkStats> ();
+
+  if (ls)
+    ls->UpdateUsage ();
+  else
+    channel->UpdateUsage ();
+}
+
 void
 LinkStatsLogger::Compute ()
 {
-  for (ChannelContainer::Iterator i = m_linksLog.Begin (); i != m_linksLog.End (); ++i)
-    (*i)->UpdateUsage ();
+  for (ChannelContainer::Iterator i = m_links.Begin (); i != m_links.End (); ++i)
+    UpdateUsage (*i);
 }
 
 void
@@ -77,39 +89,41 @@ LinkStatsLogger::ComputeStatsAll (Time interval, Time stop)
 }
 
 void
-LinkStatsLogger::ComputeStatsLog (Time interval, Time stop, Ptr<Channel> channel, std::string path)
+LinkStatsLogger::ComputeStatsLog (Time interval, Time stop, Ptr<Channel> channel, std::string path,
+                                  std::string format)
 {
   Ptr<LinkStats> ls = channel->GetObject<LinkStats> ();
 
   if (ls)
     {
-      CreateLogFile (path);
-      ls->LogStats (interval, stop, m_streamWrapper);
+      CreateLogFile (path, format);
+      ls->LogStats (interval, stop, m_writer);
     }
 }
 
 void
 LinkStatsLogger::Log ()
 {
-  for (ChannelContainer::Iterator i = m_linksLog.Begin (); i != m_linksLog.End (); ++i)
-    (*i)->GetObject<LinkStats> ()->LogStatsInternal (m_streamWrapper);
+  for (uint32_t i = 0; i < m_linksLog.GetN (); i++)
+    m_linksLog.Get (i)->GetObject<LinkStats> ()->LogStatsInternal (m_writer, m_entities[i]);
 }
 
 void
-LinkStatsLogger::ComputeStatsLog (Time interval, Time stop, ChannelContainer c, std::string path)
+LinkStatsLogger::ComputeStatsLog (Time interval, Time stop, ChannelContainer c, std::string path,
+                                  std::string format)
 {
-  CreateLogFile (path);
+  CreateLogFile (path, format);
   for (ChannelContainer::Iterator i = c.Begin (); i != c.End (); ++i)
     {
       Ptr<LinkStats> ls = (*i)->GetObject<LinkStats> ();
 
       if (ls)
-        m_linksLog.Add (*i);
+        {
+          m_linksLog.Add (*i);
+          m_entities.push_back (m_writer->AddEntity (Names::FindName (*i)));
+        }
     }
 
-  std::ostream *stream = m_streamWrapper->GetStream ();
-  *stream << "Time;LinkName;LinkUsage\n";
-
   Time i = Seconds (0.0);
   while (i <= stop)
     {
@@ -119,16 +133,24 @@ LinkStatsLogger::ComputeStatsLog (Time interval, Time stop, ChannelContainer c,
 }
 
 void
-LinkStatsLogger::ComputeStatsAllLog (Time interval, Time stop, std::string path)
+LinkStatsLogger::ComputeStatsAllLog (Time interval, Time stop, std::string path,
+                                     std::string format)
+{
+  ComputeStatsLog (interval, stop, ChannelContainer::GetSwitch2Switch (), path, format);
+}
+
+void
+LinkStatsLogger::SetWindow (TraceWindow window)
 {
-  ComputeStatsLog (interval, stop, ChannelContainer::GetSwitch2Switch (), path);
+  NS_ABORT_MSG_IF (!m_writer, "Link stats are not logged to a file");
+  m_writer->SetWindow (window);
 }
 
 void
-LinkStatsLogger::CreateLogFile (std::string path)
+LinkStatsLogger::CreateLogFile (std::string path, std::string format)
 {
-  if (!m_streamWrapper)
-    m_streamWrapper = Create<OutputStreamWrapper> (path, std::ios::out);
+  if (!m_writer)
+    m_writer = Create<TraceWriter> (path, format, LinkStats::GetTraceSchema ());
 }
 
 } // namespace ns3
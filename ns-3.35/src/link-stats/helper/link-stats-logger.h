@@ -25,7 +25,7 @@
 
 #include "ns3/channel-container.h"
 #include "ns3/core-module.h"
-#include "ns3/output-stream-wrapper.h"
+#include "ns3/trace-writer.h"
 
 namespace ns3 {
 
@@ -40,19 +40,28 @@ public:
   void ComputeStatsAll (Time interval, Time stop);
 
   void ComputeStatsLog (Time interval, Time stop, Ptr<Channel> channel,
-                        std::string path = "link-stats");
+                        std::string path = "link-stats", std::string format = "csv");
   void ComputeStatsLog (Time interval, Time stop, ChannelContainer c,
-                        std::string path = "link-stats");
-  void ComputeStatsAllLog (Time interval, Time stop, std::string path = "link-stats");
+                        std::string path = "link-stats", std::string format = "csv");
+  void ComputeStatsAllLog (Time interval, Time stop, std::string path = "link-stats",
+                           std::string format = "csv");
+
+  /**
+   * Log the summaries of the link usage over windows, once the log file is
+   * created.
+   */
+  void SetWindow (TraceWindow window);
 
 private:
-  void CreateLogFile (std::string path);
+  void CreateLogFile (std::string path, std::string format);
+  static void UpdateUsage (Ptr<Channel> channel);
   void Compute ();
   void Log ();
 
-  static Ptr<OutputStreamWrapper> m_streamWrapper;
+  static Ptr<TraceWriter> m_writer;
   static ChannelContainer m_links;
   static ChannelContainer m_linksLog;
+  static std::vector<uint32_t> m_entities; //!< Trace entity of each logged link
 };
 
 } // namespace ns3
@@ -29,11 +29,18 @@ NS_OBJECT_ENSURE_REGISTERED (LinkStats);
 TypeId
 LinkStats::GetTypeId (void)
 {
-  static TypeId tid = TypeId ("ns3::LinkStats").SetParent<Object> ().AddConstructor<LinkStats> ();
+  static TypeId tid =
+      TypeId ("ns3::LinkStats")
+          .SetParent<Object> ()
+          .AddConstructor<LinkStats> ()
+          .AddAttribute ("HistorySize", "The usage updates kept for queries.", UintegerValue (512),
+                         MakeUintegerAccessor (&LinkStats::SetHistorySize,
+                                               &LinkStats::GetHistorySize),
+                         MakeUintegerChecker<uint32_t> ());
   return tid;
 }
 
-LinkStats::LinkStats ()
+LinkStats::LinkStats () : m_usage (0)
 {
   m_channel = 0;
 }
@@ -42,25 +49,34 @@ LinkStats::~LinkStats ()
 {
 }
 
+TraceSchema
+LinkStats::GetTraceSchema (void)
+{
+  // Forward from the first device of the channel to the second one
+  return {"LinkName",
+          {{"LinkUsage", TraceColumn::REAL},
+           {"ForwardUsage", TraceColumn::REAL},
+           {"ReverseUsage", TraceColumn::REAL}}};
+}
+
 void
-LinkStats::LogStats (Time interval, Time stop, Ptr<OutputStreamWrapper> streamWrapper)
+LinkStats::LogStats (Time interval, Time stop, Ptr<TraceWriter> writer)
 {
+  uint32_t entity = writer->AddEntity (Names::FindName (m_channel));
+
   Time i = Seconds (0.0);
   while (i <= stop)
     {
-      Simulator::Schedule (i, &LinkStats::LogStatsInternal, this, streamWrapper);
+      Simulator::Schedule (i, &LinkStats::LogStatsInternal, this, writer, entity);
       i += interval;
     }
 }
 
 void
-LinkStats::LogStatsInternal (Ptr<OutputStreamWrapper> streamWrapper)
+LinkStats::LogStatsInternal (Ptr<TraceWriter> writer, uint32_t entity)
 {
-  std::string linkName = Names::FindName (m_channel);
-
-  std::ostream *stream = streamWrapper->GetStream ();
-  *stream << std::fixed << Simulator::Now ().GetSeconds () << ";" << linkName << ";"
-          << m_channel->GetChannelUsage () << "\n";
+  writer->Write (entity, {m_channel->GetChannelUsage (), m_channel->GetDirectionUsage (0),
+                          m_channel->GetDirectionUsage (1)});
 }
 
 void
@@ -69,4 +85,42 @@ LinkStats::SetChannel (Ptr<Channel> channel)
   m_channel = channel;
 }
 
+void
+LinkStats::UpdateUsage (void)
+{
+  m_channel->UpdateUsage ();
+  m_usage.Append (Simulator::Now (), m_channel->GetChannelUsage ());
+}
+
+double
+LinkStats::GetUtilisation (Time window) const
+{
+  uint32_t n = m_usage.CountSince (Simulator::Now () - window);
+  if (!n)
+    return 0;
+
+  double sum = 0;
+  for (uint32_t age = 0; age < n; age++)
+    sum += m_usage.Get (age).value;
+  return sum / n;
+}
+
+std::vector<MetricHistory<double>::Sample>
+LinkStats::GetUsageSeries (uint32_t n) const
+{
+  return m_usage.GetLast (n);
+}
+
+void
+LinkStats::SetHistorySize (uint32_t size)
+{
+  m_usage.SetCapacity (size);
+}
+
+uint32_t
+LinkStats::GetHistorySize (void) const
+{
+  return m_usage.GetCapacity ();
+}
+
 } // namespace ns3
@@ -25,7 +25,8 @@
 
 #include "ns3/core-module.h"
 #include "ns3/channel.h"
-#include "ns3/output-stream-wrapper.h"
+#include "ns3/metric-history.h"
+#include "ns3/trace-writer.h"
 
 namespace ns3 {
 
@@ -36,12 +37,34 @@ public:
   LinkStats ();
   virtual ~LinkStats ();
 
-  void LogStats (Time interval, Time stop, Ptr<OutputStreamWrapper> streamWrapper);
-  void LogStatsInternal (Ptr<OutputStreamWrapper> streamWrapper);
+  static TraceSchema GetTraceSchema (void);
+
+  void LogStats (Time interval, Time stop, Ptr<TraceWriter> writer);
+  void LogStatsInternal (Ptr<TraceWriter> writer, uint32_t entity);
   void SetChannel (Ptr<Channel> channel);
 
+  /**
+   * Update the usage of the channel and keep it in the usage history.
+   */
+  void UpdateUsage (void);
+
+  /**
+   * \returns The mean usage of the updates in the last window, 0 without
+   * any.
+   */
+  double GetUtilisation (Time window) const;
+
+  /**
+   * \returns Up to the n last usage updates, oldest first.
+   */
+  std::vector<MetricHistory<double>::Sample> GetUsageSeries (uint32_t n) const;
+
 private:
+  void SetHistorySize (uint32_t size);
+  uint32_t GetHistorySize (void) const;
+
   Ptr<Channel> m_channel;
+  MetricHistory<double> m_usage;
 };
 
 } // namespace ns3
@@ -67,6 +67,12 @@ Channel::GetChannelUsage (void)
   return m_usage;
 }
 
+double
+Channel::GetDirectionUsage (std::size_t direction)
+{
+  return m_usage;
+}
+
 void
 Channel::ComputeUsage (Time interval, Time stop)
 {
@@ -78,6 +78,12 @@ public:
 
   double GetChannelUsage (void);
 
+  /**
+   * \param direction index of the NetDevice transmitting in that direction
+   * \returns the usage of the direction, by default that of the channel
+   */
+  virtual double GetDirectionUsage (std::size_t direction);
+
   void ComputeUsage (Time interval, Time stop);
 
   // To be implemented by subclasses
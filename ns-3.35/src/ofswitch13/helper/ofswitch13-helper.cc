@@ -21,7 +21,9 @@
 #ifdef NS3_OFSWITCH13
 
 #include <ns3/ofswitch13-port.h>
+#include <ns3/trace-helper.h>
 #include "ofswitch13-helper.h"
+#include "ofswitch13-pcap-writer.h"
 #include "ofswitch13-stats-calculator.h"
 
 namespace ns3 {
@@ -58,6 +60,11 @@ OFSwitch13Helper::GetTypeId (void)
                          DataRateValue (DataRate ("10Gb/s")),
                          MakeDataRateAccessor (&OFSwitch13Helper::SetChannelDataRate),
                          MakeDataRateChecker ())
+          .AddAttribute ("ChannelLatency",
+                         "The latency of the OpenFlow channel, for direct channels.",
+                         TimeValue (Seconds (0)),
+                         MakeTimeAccessor (&OFSwitch13Helper::m_channelLatency),
+                         MakeTimeChecker ())
           .AddAttribute (
               "ChannelType", "The configuration used to create the OpenFlow channel",
               TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT, EnumValue (OFSwitch13Helper::SINGLECSMA),
@@ -65,7 +72,8 @@ OFSwitch13Helper::GetTypeId (void)
               MakeEnumChecker (OFSwitch13Helper::SINGLECSMA, "SingleCsma",
                                OFSwitch13Helper::DEDICATEDCSMA, "DedicatedCsma",
                                OFSwitch13Helper::DEDICATEDP2P, "DedicatedP2p",
-                               OFSwitch13Helper::DEDICATEDP2PETHERNET, "DedicatedP2pEthernet"));
+                               OFSwitch13Helper::DEDICATEDP2PETHERNET, "DedicatedP2pEthernet",
+                               OFSwitch13Helper::DIRECT, "Direct"));
   return tid;
 }
 
@@ -115,12 +123,65 @@ OFSwitch13Helper::EnableOpenFlowPcap (std::string prefix, bool promiscuous)
         m_p2pEthernetHelper.EnablePcap (prefix, m_controlDevs, promiscuous);
         break;
       }
+      case OFSwitch13Helper::DIRECT: {
+        NS_LOG_INFO ("No packets to capture on direct OpenFlow channels.");
+        break;
+      }
       default: {
         NS_ABORT_MSG ("Invalid OpenflowChannelType.");
       }
     }
 }
 
+void
+OFSwitch13Helper::EnableOpenFlowPcap (std::string prefix, NodeContainer switches,
+                                      uint32_t snapLen, uint64_t ringSize)
+{
+  NS_LOG_FUNCTION (this << prefix << switches.GetN () << snapLen << ringSize);
+
+  NS_ABORT_MSG_IF (!m_blocked, "OpenFlow channels not configured yet.");
+  uint32_t dataLinkType;
+  switch (m_channelType)
+    {
+    case OFSwitch13Helper::SINGLECSMA:
+    case OFSwitch13Helper::DEDICATEDCSMA:
+      case OFSwitch13Helper::DEDICATEDP2PETHERNET: {
+        dataLinkType = PcapHelper::DLT_EN10MB;
+        break;
+      }
+      case OFSwitch13Helper::DEDICATEDP2P: {
+        dataLinkType = PcapHelper::DLT_PPP;
+        break;
+      }
+      case OFSwitch13Helper::DIRECT: {
+        NS_LOG_INFO ("No packets to capture on direct OpenFlow channels.");
+        return;
+      }
+      default: {
+        NS_ABORT_MSG ("Invalid OpenflowChannelType.");
+      }
+    }
+
+  PcapHelper pcapHelper;
+  for (NetDeviceContainer::Iterator dev = m_controlDevs.Begin (); dev != m_controlDevs.End ();
+       dev++)
+    {
+      // Capture the channels reaching any of the switches
+      Ptr<Channel> channel = (*dev)->GetChannel ();
+      bool captured = false;
+      for (size_t i = 0; i < channel->GetNDevices () && !captured; i++)
+        captured = switches.Contains (channel->GetDevice (i)->GetNode ()->GetId ());
+      if (!captured)
+        continue;
+
+      Ptr<OFSwitch13PcapWriter> writer = Create<OFSwitch13PcapWriter> (
+          pcapHelper.GetFilenameFromDevice (prefix, *dev), dataLinkType, snapLen, ringSize);
+      (*dev)->TraceConnectWithoutContext ("PromiscSniffer",
+                                          MakeCallback (&OFSwitch13PcapWriter::Write, writer));
+      Simulator::ScheduleDestroy (&OFSwitch13PcapWriter::Close, writer);
+    }
+}
+
 void
 OFSwitch13Helper::EnableOpenFlowAscii (std::string prefix)
 {
@@ -139,6 +200,10 @@ OFSwitch13Helper::EnableOpenFlowAscii (std::string prefix)
         m_p2pHelper.EnableAsciiAll (ascii.CreateFileStream (prefix + ".txt"));
         break;
       }
+      case OFSwitch13Helper::DIRECT: {
+        NS_LOG_INFO ("No packets to trace on direct OpenFlow channels.");
+        break;
+      }
       default: {
         NS_ABORT_MSG ("Invalid OpenflowChannelType.");
       }
@@ -219,8 +284,8 @@ OFSwitch13Helper::InstallSwitch (Ptr<Node> swNode)
   NS_LOG_INFO ("Installing OpenFlow device on node " << swNode->GetId ());
   NS_ABORT_MSG_IF (m_blocked, "OpenFlow channels already configured.");
 
-  // Install the TCP/IP stack into switch node.
-  if (swNode->GetObject<Ipv4> () == 0)
+  // Install the TCP/IP stack into switch node, unless directly connected.
+  if (swNode->GetObject<Ipv4> () == 0 && m_channelType != OFSwitch13Helper::DIRECT)
     {
       m_internet.Install (swNode);
     }
@@ -58,7 +58,10 @@ class OFSwitch13LearningController;
  * using a /24 network mask. Users can modify this configuration by changing
  * the ChannelType attribute at instantiation time. Dedicated out-of-band
  * connections over CSMA or Point-to-Point channels are also available, using a
- * /30 network mask for IP allocation.
+ * /30 network mask for IP allocation. Internal controllers can also be
+ * connected directly, without any network: OpenFlow messages are then
+ * delivered by scheduled calls after the ChannelLatency, with no sockets,
+ * TCP/IP stack or pcap traces.
  *
  * Please note that this base helper class was designed to configure a single
  * OpenFlow network domain. All switches will be connected to all controllers
@@ -80,7 +83,8 @@ public:
     SINGLECSMA = 0, //!< Uses a single shared CSMA channel.
     DEDICATEDCSMA = 1, //!< Uses individual CSMA channels.
     DEDICATEDP2P = 2, //!< Uses individual P2P channels.
-    DEDICATEDP2PETHERNET = 3 //!< Uses individual P2PEthernet channels.
+    DEDICATEDP2PETHERNET = 3, //!< Uses individual P2PEthernet channels.
+    DIRECT = 4 //!< Uses scheduled calls, for internal controllers only.
   };
 
   OFSwitch13Helper (); //!< Default constructor.
@@ -126,6 +130,21 @@ public:
    */
   void EnableOpenFlowPcap (std::string prefix = "ofchannel", bool promiscuous = true);
 
+  /**
+   * Enable pcap traces at OpenFlow channel between controller and some
+   * switches, written in batches by an OFSwitch13PcapWriter. Packets are
+   * captured at the controller side of each channel.
+   *
+   * \attention Call this method only after configuring the OpenFlow channels.
+   *
+   * \param prefix Filename prefix to use for pcap files.
+   * \param switches The switches whose channels are captured.
+   * \param snapLen The bytes captured per packet, 0 for all of them.
+   * \param ringSize The last bytes of capture kept per file, 0 to keep all.
+   */
+  void EnableOpenFlowPcap (std::string prefix, NodeContainer switches, uint32_t snapLen = 0,
+                           uint64_t ringSize = 0);
+
   /**
    * Enable ASCII traces at OpenFlow channel between controller and switches.
    *
@@ -217,6 +236,7 @@ protected:
 
   ChannelType m_channelType; //!< OF channel type.
   DataRate m_channelDataRate; //!< OF channel data rate.
+  Time m_channelLatency; //!< OF channel latency, for direct channels.
   ObjectFactory m_devFactory; //!< OF device factory.
   bool m_blocked; //!< Block this helper.
 
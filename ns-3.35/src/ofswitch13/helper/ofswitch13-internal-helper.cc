@@ -148,6 +148,43 @@ OFSwitch13InternalHelper::CreateOpenFlowChannels (void)
           }
         break;
       }
+      case OFSwitch13InternalHelper::DIRECT: {
+        // Addresses in 127.0.0.0/8 only identify the direct connections,
+        // the controllers first.
+        uint32_t nextAddr = Ipv4Address::GetLoopback ().Get ();
+        std::vector<InetSocketAddress> ctrlAddrs;
+        UintegerValue portValue;
+        for (uint32_t ctIdx = 0; ctIdx < m_controlApps.GetN (); ctIdx++)
+          {
+            m_controlApps.Get (ctIdx)->GetAttribute ("Port", portValue);
+            ctrlAddrs.push_back (InetSocketAddress (Ipv4Address (nextAddr++), portValue.Get ()));
+          }
+
+        for (uint32_t swIdx = 0; swIdx < m_switchNodes.GetN (); swIdx++)
+          {
+            Ptr<OFSwitch13Device> ofDev = m_openFlowDevs.Get (swIdx);
+            InetSocketAddress swAddr (Ipv4Address (nextAddr++), 0);
+
+            for (uint32_t ctIdx = 0; ctIdx < m_controlApps.GetN (); ctIdx++)
+              {
+                Ptr<OFSwitch13Controller> ctrl =
+                    DynamicCast<OFSwitch13Controller> (m_controlApps.Get (ctIdx));
+
+                NS_LOG_INFO ("Connect switch " << ofDev->GetDatapathId ()
+                                               << " directly to controller "
+                                               << ctrlAddrs[ctIdx].GetIpv4 ());
+                Simulator::ScheduleNow (
+                    &OFSwitch13Controller::StartDirectSwitchConnection, ctrl, swAddr,
+                    ctrlAddrs[ctIdx], m_channelLatency,
+                    MakeCallback (&OFSwitch13Device::ReceiveBufferFromController, ofDev));
+                Simulator::ScheduleNow (
+                    &OFSwitch13Device::StartDirectControllerConnection, ofDev, ctrlAddrs[ctIdx],
+                    swAddr, m_channelLatency,
+                    MakeCallback (&OFSwitch13Controller::ReceiveBufferFromSwitch, ctrl));
+              }
+          }
+        break;
+      }
       default: {
         NS_ABORT_MSG ("Invalid OpenflowChannelType.");
       }
@@ -162,8 +199,8 @@ OFSwitch13InternalHelper::InstallController (Ptr<Node> cNode, Ptr<OFSwitch13Cont
   NS_LOG_INFO ("Installing OpenFlow controller on node " << cNode->GetId ());
   NS_ABORT_MSG_IF (m_blocked, "OpenFlow channels already configured.");
 
-  // Install the TCP/IP stack into controller node.
-  if (cNode->GetObject<Ipv4> () == 0)
+  // Install the TCP/IP stack into controller node, unless directly connected.
+  if (cNode->GetObject<Ipv4> () == 0 && m_channelType != OFSwitch13InternalHelper::DIRECT)
     {
       m_internet.Install (cNode);
     }
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ofswitch13-pcap-writer.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("OFSwitch13PcapWriter");
+
+static const uint32_t PCAP_MAGIC = 0xa1b2c3d4;
+static const uint16_t PCAP_VERSION_MAJOR = 2;
+static const uint16_t PCAP_VERSION_MINOR = 4;
+
+OFSwitch13PcapWriter::OFSwitch13PcapWriter (std::string filename, uint32_t dataLinkType,
+                                            uint32_t snapLen, uint64_t ringSize)
+    : m_filename (filename),
+      m_dataLinkType (dataLinkType),
+      m_snapLen (snapLen && snapLen < MAX_SNAPLEN ? snapLen : MAX_SNAPLEN),
+      m_ringSize (ringSize),
+      m_created (false),
+      m_ringBytes (0)
+{
+  NS_LOG_FUNCTION (this << filename << dataLinkType << snapLen << ringSize);
+}
+
+OFSwitch13PcapWriter::~OFSwitch13PcapWriter ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+OFSwitch13PcapWriter::Write (Ptr<const Packet> packet)
+{
+  if (!m_ringSize)
+    {
+      AppendRecord (m_batch, packet);
+      if (m_batch.size () >= BATCH_SIZE)
+        Flush ();
+      return;
+    }
+
+  m_ring.emplace_back ();
+  AppendRecord (m_ring.back (), packet);
+  m_ringBytes += m_ring.back ().size ();
+
+  // The last record is kept even if larger than the ring
+  while (m_ringBytes > m_ringSize && m_ring.size () > 1)
+    {
+      m_ringBytes -= m_ring.front ().size ();
+      m_ring.pop_front ();
+    }
+}
+
+void
+OFSwitch13PcapWriter::Close (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  for (const std::string &record : m_ring)
+    m_batch.append (record);
+  m_ring.clear ();
+  m_ringBytes = 0;
+
+  Flush ();
+}
+
+void
+OFSwitch13PcapWriter::AppendRecord (std::string &out, Ptr<const Packet> packet)
+{
+  uint64_t us = Simulator::Now ().GetMicroSeconds ();
+  uint32_t origLen = packet->GetSize ();
+  uint32_t inclLen = std::min (origLen, m_snapLen);
+  uint32_t header[4] = {uint32_t (us / 1000000), uint32_t (us % 1000000), inclLen, origLen};
+
+  size_t offset = out.size ();
+  out.resize (offset + sizeof (header) + inclLen);
+  memcpy (&out[offset], header, sizeof (header));
+  packet->CopyData ((uint8_t *) &out[offset + sizeof (header)], inclLen);
+}
+
+void
+OFSwitch13PcapWriter::Flush (void)
+{
+  NS_LOG_FUNCTION (this << m_batch.size ());
+
+  std::ofstream file (m_filename, m_created ? std::ios::binary | std::ios::app
+                                            : std::ios::binary | std::ios::trunc);
+  NS_ABORT_MSG_IF (!file, "Cannot write " << m_filename);
+
+  if (!m_created)
+    {
+      uint32_t magic = PCAP_MAGIC;
+      uint16_t version[2] = {PCAP_VERSION_MAJOR, PCAP_VERSION_MINOR};
+      int32_t zone = 0;
+      uint32_t fields[3] = {0, m_snapLen, m_dataLinkType}; // Sigfigs, snaplen, link type
+      file.write ((const char *) &magic, sizeof (magic));
+      file.write ((const char *) version, sizeof (version));
+      file.write ((const char *) &zone, sizeof (zone));
+      file.write ((const char *) fields, sizeof (fields));
+      m_created = true;
+    }
+
+  file.write (m_batch.data (), m_batch.size ());
+  NS_ABORT_MSG_IF (!file, "Cannot write " << m_filename);
+  m_batch.clear ();
+}
+
+} // namespace ns3
@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef OFSWITCH13_PCAP_WRITER_H
+#define OFSWITCH13_PCAP_WRITER_H
+
+#include <deque>
+#include <string>
+#include "ns3/packet.h"
+#include "ns3/simple-ref-count.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup ofswitch13
+ * \brief Pcap file writer batching the records in memory.
+ *
+ * Records are written in batches, opening the file only for each batch, so
+ * many captures can be enabled at once without holding their files open.
+ * Packets may be truncated to a snapshot length. With a ring size, only the
+ * last records up to that size are kept, and written when the simulation is
+ * destroyed.
+ */
+class OFSwitch13PcapWriter : public SimpleRefCount<OFSwitch13PcapWriter>
+{
+public:
+  /**
+   * \param filename The pcap file, replaced when first written.
+   * \param dataLinkType The pcap data link type, see PcapHelper.
+   * \param snapLen The bytes captured per packet, 0 for all of them.
+   * \param ringSize The bytes of records kept, 0 to keep them all.
+   */
+  OFSwitch13PcapWriter (std::string filename, uint32_t dataLinkType, uint32_t snapLen,
+                        uint64_t ringSize);
+  ~OFSwitch13PcapWriter ();
+
+  /**
+   * Record a packet at the current simulation time, to be connected to a
+   * sniffer trace source.
+   */
+  void Write (Ptr<const Packet> packet);
+
+  /**
+   * Write the pending records. Scheduled on Simulator::Destroy.
+   */
+  void Close (void);
+
+private:
+  static const uint32_t MAX_SNAPLEN = 65535;
+  static const size_t BATCH_SIZE = 1 << 20; //!< Bytes of records per write
+
+  void AppendRecord (std::string &out, Ptr<const Packet> packet);
+  void Flush (void);
+
+  std::string m_filename;
+  uint32_t m_dataLinkType;
+  uint32_t m_snapLen;
+  uint64_t m_ringSize;
+  bool m_created; //!< Whether the file holds its header
+
+  std::string m_batch; //!< Records not yet written
+  std::deque<std::string> m_ring; //!< Last records, with a ring size
+  uint64_t m_ringBytes;
+};
+
+} // namespace ns3
+
+#endif /* OFSWITCH13_PCAP_WRITER_H */
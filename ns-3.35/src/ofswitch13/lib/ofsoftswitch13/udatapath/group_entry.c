@@ -34,7 +34,10 @@
 #include "group_table.h"
 #include "dp_actions.h"
 #include "datapath.h"
+#include "packet.h"
+#include "packet_handle_std.h"
 #include "util.h"
+#include "lib/hash.h"
 #include "oflib/ofl.h"
 #include "oflib/ofl-structs.h"
 #include "oflib/ofl-utils.h"
@@ -54,22 +57,16 @@ struct flow_ref_entry
   struct flow_entry *entry;
 };
 
-/* Private data for select groups; for implementing weighted round-robin. */
-struct group_entry_wrr_data
-{
-  uint16_t max_weight; /* maximum weight of the buckets. */
-  uint16_t gcd_weight; /* g.c.d. of bucket weights. */
-  uint16_t curr_weight; /* current weight in w.r.r. algorithm. */
-  size_t curr_bucket; /* bucket executed last time. */
-};
-
-static uint16_t gcd (uint16_t a, uint16_t b);
+/* Basis of the flow hash of select groups, fixed so runs are reproducible. */
+#define SELECT_HASH_BASIS 0x5e1ec7
 
 static bool bucket_is_alive (struct ofl_bucket *bucket, struct datapath *dp);
 
-static void init_select_group (struct group_entry *entry, struct ofl_msg_group_mod *mod);
+static bool select_bucket_is_live (struct ofl_bucket *bucket, struct datapath *dp);
 
-static size_t select_from_select_group (struct group_entry *entry);
+static uint32_t select_hash (struct packet *pkt);
+
+static size_t select_from_select_group (struct group_entry *entry, struct packet *pkt);
 
 static size_t select_from_ff_group (struct group_entry *entry);
 
@@ -105,16 +102,7 @@ group_entry_create (struct datapath *dp, struct group_table *table, struct ofl_m
       entry->stats->counters[i]->packet_count = 0;
       entry->stats->counters[i]->byte_count = 0;
     }
-  switch (mod->type)
-    {
-      case (OFPGT_SELECT): {
-        init_select_group (entry, mod);
-        break;
-      }
-      default: {
-        entry->data = NULL;
-      }
-    }
+  entry->data = NULL;
   list_init (&entry->flow_refs);
   return entry;
 }
@@ -178,7 +166,7 @@ execute_all (struct group_entry *entry, struct packet *pkt)
 static void
 execute_select (struct group_entry *entry, struct packet *pkt)
 {
-  size_t b = select_from_select_group (entry);
+  size_t b = select_from_select_group (entry, pkt);
 
   if (b != -1)
     {
@@ -405,75 +393,83 @@ bucket_is_alive (struct ofl_bucket *bucket, struct datapath *dp)
   return true;
 }
 
-/* Initializes the private w.r.r. data for a select group entry. */
-static void
-init_select_group (struct group_entry *entry, struct ofl_msg_group_mod *mod)
+/* Returns true if a select bucket can be used, i.e. it watches no port or
+ * a live one. */
+static bool
+select_bucket_is_live (struct ofl_bucket *bucket, struct datapath *dp)
 {
-  struct group_entry_wrr_data *data;
-  size_t i;
+  return bucket->watch_port == OFPP_ANY || bucket_is_alive (bucket, dp);
+}
 
-  entry->data = xmalloc (sizeof (struct group_entry_wrr_data));
-  data = (struct group_entry_wrr_data *) entry->data;
+/* Hashes the 5-tuple of a packet, or its Ethernet addresses if it is not
+ * IPv4, so that every packet of a flow takes the same bucket. */
+static uint32_t
+select_hash (struct packet *pkt)
+{
+  struct protocols_std *proto;
+  uint32_t words[4] = {0, 0, 0, 0};
 
-  data->curr_weight = 0;
-  data->curr_bucket = -1;
+  packet_handle_std_validate (pkt->handle_std);
+  proto = pkt->handle_std->proto;
 
-  if (mod->buckets_num == 0)
-    {
-      data->gcd_weight = 0;
-      data->max_weight = 0;
-    }
-  else
+  if (proto->ipv4 == NULL)
     {
-      data->gcd_weight = entry->desc->buckets[0]->weight;
-      data->max_weight = entry->desc->buckets[0]->weight;
-
-      for (i = 1; i < entry->desc->buckets_num; i++)
+      if (proto->eth == NULL)
         {
-          data->gcd_weight = gcd (data->gcd_weight, entry->desc->buckets[i]->weight);
-          data->max_weight = MAX (data->max_weight, entry->desc->buckets[i]->weight);
+          return 0;
         }
+      return hash_bytes (proto->eth, 2 * ETH_ADDR_LEN, SELECT_HASH_BASIS);
+    }
+
+  words[0] = proto->ipv4->ip_src;
+  words[1] = proto->ipv4->ip_dst;
+  words[2] = proto->ipv4->ip_proto;
+  if (proto->tcp != NULL)
+    {
+      words[3] = ((uint32_t) proto->tcp->tcp_src << 16) | proto->tcp->tcp_dst;
     }
+  else if (proto->udp != NULL)
+    {
+      words[3] = ((uint32_t) proto->udp->udp_src << 16) | proto->udp->udp_dst;
+    }
+  return hash_words (words, 4, SELECT_HASH_BASIS);
 }
 
-/* Selects a bucket from a select group, based on the w.r.r. algorithm. */
+/* Selects a live bucket from a select group, with a probability proportional
+ * to its weight, by hashing the flow of the packet. */
 static size_t
-select_from_select_group (struct group_entry *entry)
+select_from_select_group (struct group_entry *entry, struct packet *pkt)
 {
-  struct group_entry_wrr_data *data;
-  size_t guard;
+  uint32_t total_weight, point;
+  size_t i;
 
-  if (entry->desc->buckets_num == 0)
+  total_weight = 0;
+  for (i = 0; i < entry->desc->buckets_num; i++)
     {
-      return -1;
+      if (select_bucket_is_live (entry->desc->buckets[i], entry->dp))
+        {
+          total_weight += entry->desc->buckets[i]->weight;
+        }
     }
 
-  data = (struct group_entry_wrr_data *) entry->data;
-  guard = 0;
-
-  while (guard < entry->desc->buckets_num)
+  if (total_weight == 0)
     {
-      data->curr_bucket = (data->curr_bucket + 1) % entry->desc->buckets_num;
+      VLOG_WARN_RL (LOG_MODULE, &rl, "Could not select from select group.");
+      return -1;
+    }
 
-      if (data->curr_bucket == 0)
+  point = select_hash (pkt) % total_weight;
+  for (i = 0; i < entry->desc->buckets_num; i++)
+    {
+      if (select_bucket_is_live (entry->desc->buckets[i], entry->dp))
         {
-          if (data->curr_weight <= data->gcd_weight)
+          if (point < entry->desc->buckets[i]->weight)
             {
-              data->curr_weight = data->max_weight;
+              return i;
             }
-          else
-            {
-              data->curr_weight = data->curr_weight - data->gcd_weight;
-            }
-        }
-
-      if (entry->desc->buckets[data->curr_bucket]->weight >= data->curr_weight)
-        {
-          return data->curr_bucket;
+          point -= entry->desc->buckets[i]->weight;
         }
-      guard++;
     }
-  VLOG_WARN_RL (LOG_MODULE, &rl, "Could not select from select group.");
   return -1;
 }
 
@@ -492,19 +488,3 @@ select_from_ff_group (struct group_entry *entry)
     }
   return -1;
 }
-
-/* Returns the g.c.d. of the two numbers. */
-static uint16_t
-gcd (uint16_t a, uint16_t b)
-{
-  uint16_t c;
-
-  while (a != 0)
-    {
-      c = a;
-      a = b % a;
-      b = c;
-    }
-
-  return b;
-}
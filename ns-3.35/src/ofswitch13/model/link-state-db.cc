@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "link-state-db.h"
+#include <algorithm>
+#include "ns3/topology-module.h"
+
+namespace ns3 {
+
+LinkStateDb::LinkStateDb ()
+{
+}
+
+LinkStateDb::~LinkStateDb ()
+{
+}
+
+LinkStateDb::Link
+LinkStateDb::GetLink (Ptr<Node> n1, Ptr<Node> n2)
+{
+  return {std::min (n1->GetId (), n2->GetId ()), std::max (n1->GetId (), n2->GetId ())};
+}
+
+bool
+LinkStateDb::ReportPort (Ptr<Node> sw, Ptr<Node> peer, bool up)
+{
+  LinkState &state = m_links[GetLink (sw, peer)];
+  bool wasUp = state.downEnds.empty ();
+
+  if (up)
+    state.downEnds.erase (sw->GetId ());
+  else
+    state.downEnds.insert (sw->GetId ());
+
+  if (wasUp == state.downEnds.empty ())
+    return false;
+
+  Topology::SetLinkUp (sw, peer, !wasUp);
+  return true;
+}
+
+bool
+LinkStateDb::IsLinkUp (Link link) const
+{
+  auto it = m_links.find (link);
+  return it == m_links.end () || it->second.downEnds.empty ();
+}
+
+size_t
+LinkStateDb::GetRouteIndex (Route route)
+{
+  auto it = m_routeIndex.find (route);
+  if (it != m_routeIndex.end ())
+    return it->second;
+
+  m_routeIndex[route] = m_routes.size ();
+  m_routes.push_back (route);
+  m_routeLinks.emplace_back ();
+  return m_routes.size () - 1;
+}
+
+void
+LinkStateDb::Resize (RouteSet &routes) const
+{
+  if (routes.size () < m_routes.size ())
+    routes.resize (m_routes.size ());
+}
+
+void
+LinkStateDb::ClearRoute (Route route)
+{
+  auto it = m_routeIndex.find (route);
+  if (it == m_routeIndex.end ())
+    return;
+
+  for (const Link &link : m_routeLinks[it->second])
+    {
+      RouteSet &routes = m_links[link].routes;
+      if (it->second < routes.size ())
+        routes.reset (it->second);
+    }
+  m_routeLinks[it->second].clear ();
+}
+
+void
+LinkStateDb::AddPath (Route route, const std::vector<Ptr<Node>> &path)
+{
+  size_t index = GetRouteIndex (route);
+  for (size_t i = 1; i < path.size (); i++)
+    {
+      Link link = GetLink (path[i - 1], path[i]);
+      RouteSet &routes = m_links[link].routes;
+      Resize (routes);
+      if (!routes.test (index))
+        {
+          routes.set (index);
+          m_routeLinks[index].push_back (link);
+        }
+    }
+}
+
+LinkStateDb::RouteSet
+LinkStateDb::GetAffectedRoutes (Link link)
+{
+  LinkState &state = m_links[link];
+  RouteSet affected = NewRouteSet ();
+  Resize (state.routes);
+  Resize (state.displaced);
+
+  if (state.downEnds.empty ())
+    {
+      affected |= state.displaced;
+      state.displaced.reset ();
+    }
+  else
+    {
+      affected |= state.routes;
+      state.displaced |= state.routes;
+    }
+  return affected;
+}
+
+LinkStateDb::Route
+LinkStateDb::GetRoute (size_t index) const
+{
+  return m_routes.at (index);
+}
+
+size_t
+LinkStateDb::GetNRoutes (void) const
+{
+  return m_routes.size ();
+}
+
+LinkStateDb::RouteSet
+LinkStateDb::NewRouteSet (void) const
+{
+  return RouteSet (m_routes.size ());
+}
+
+} // namespace ns3
@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef LINK_STATE_DB_H
+#define LINK_STATE_DB_H
+
+#include <map>
+#include <set>
+#include <vector>
+#include <boost/dynamic_bitset.hpp>
+#include "ns3/node.h"
+#include "ns3/simple-ref-count.h"
+
+namespace ns3 {
+
+/**
+ * \brief Link-state database of a controller, fed by the port status of the
+ * switches, with an index of the routes traversing each link.
+ *
+ * A link is down while either of its switch ends reports it down, and is
+ * then hidden from the Topology path computations. Routes, i.e. the next
+ * hop of a switch towards a destination, are given a dense index and each
+ * link keeps the bitset of the routes whose paths use it. When a link
+ * changes state only the routes it affects need to be recomputed.
+ */
+class LinkStateDb : public SimpleRefCount<LinkStateDb>
+{
+public:
+  typedef std::pair<uint32_t, uint32_t> Link; //!< Node IDs, lowest first
+  typedef std::pair<uint64_t, Ptr<Node>> Route; //!< Switch datapath ID and destination
+  typedef boost::dynamic_bitset<> RouteSet; //!< By route index
+
+  LinkStateDb ();
+  ~LinkStateDb ();
+
+  static Link GetLink (Ptr<Node> n1, Ptr<Node> n2);
+
+  /**
+   * Record the state of the port of sw towards peer.
+   *
+   * \returns Whether the link changed state.
+   */
+  bool ReportPort (Ptr<Node> sw, Ptr<Node> peer, bool up);
+  bool IsLinkUp (Link link) const;
+
+  /**
+   * Forget the paths of a route, before it is recomputed.
+   */
+  void ClearRoute (Route route);
+
+  /**
+   * Index a path of a route, multipath routes having several.
+   */
+  void AddPath (Route route, const std::vector<Ptr<Node>> &path);
+
+  /**
+   * \returns The routes to recompute after a link changed state: those
+   * using it if it is down, or those it displaced if it is back up.
+   */
+  RouteSet GetAffectedRoutes (Link link);
+
+  Route GetRoute (size_t index) const;
+  size_t GetNRoutes (void) const;
+
+  /**
+   * \returns An empty set of the current routes.
+   */
+  RouteSet NewRouteSet (void) const;
+
+private:
+  struct LinkState
+  {
+    std::set<uint32_t> downEnds; //!< Switches reporting the link down
+    RouteSet routes; //!< Using the link
+    RouteSet displaced; //!< Using the link when it went down
+  };
+
+  size_t GetRouteIndex (Route route);
+  void Resize (RouteSet &routes) const;
+
+  std::map<Link, LinkState> m_links;
+  std::map<Route, size_t> m_routeIndex;
+  std::vector<Route> m_routes;
+  std::vector<std::vector<Link>> m_routeLinks; //!< Links set in the index, per route
+};
+
+} // namespace ns3
+
+#endif /* LINK_STATE_DB_H */
@@ -70,6 +70,7 @@ OFSwitch13Controller::DoDispose ()
   m_commandsMap.clear ();
   m_dpIdSwMap.clear ();
   m_echoMap.clear ();
+  m_localSwMap.clear ();
 
   Application::DoDispose ();
 }
@@ -80,7 +81,11 @@ OFSwitch13Controller::DpctlExecute (uint64_t dpId, const std::string textCmd)
   NS_LOG_FUNCTION (this << dpId << textCmd);
 
   Ptr<const RemoteSwitch> swtch = GetRemoteSwitch (dpId);
-  if (!swtch)
+  if (!swtch && m_localSwMap.count (dpId))
+    {
+      swtch = m_localSwMap[dpId];
+    }
+  else if (!swtch)
     {
       // Save this command for further execution after handshake procedure.
       NS_LOG_DEBUG ("Schedulling command for an unregistered switch.");
@@ -140,6 +145,12 @@ OFSwitch13Controller::StartApplication ()
 {
   NS_LOG_FUNCTION (this << m_port);
 
+  // Switches connected directly need no listening socket
+  if (!GetNode ()->GetObject<TcpSocketFactory> ())
+    {
+      return;
+    }
+
   // Create the server listening socket
   TypeId tcpFactory = TypeId::LookupByName ("ns3::TcpSocketFactory");
   m_serverSocket = Socket::CreateSocket (GetNode (), tcpFactory);
@@ -176,6 +187,7 @@ OFSwitch13Controller::StopApplication ()
   m_commandsMap.clear ();
   m_dpIdSwMap.clear ();
   m_echoMap.clear ();
+  m_localSwMap.clear ();
 }
 
 uint32_t
@@ -220,6 +232,30 @@ OFSwitch13Controller::SendToSwitch (Ptr<const RemoteSwitch> swtch, struct ofl_ms
       xid = GetNextXid ();
     }
 
+  // Local switches process the packed message at once.
+  if (!swtch->m_local.IsNull ())
+    {
+      struct ofpbuf *buffer = ofs::BufferFromMsg (msg, xid);
+      if (!buffer)
+        {
+          return -1;
+        }
+      swtch->m_local (buffer);
+      return 0;
+    }
+
+  // Direct connections deliver the packed message as is.
+  if (!swtch->m_direct.IsNull ())
+    {
+      struct ofpbuf *buffer = ofs::BufferFromMsg (msg, xid);
+      if (!buffer)
+        {
+          return -1;
+        }
+      ofs::ScheduleDirect (swtch->m_latency, swtch->m_direct, buffer, swtch->m_localAddress);
+      return 0;
+    }
+
   // Create the packet from the OpenFlow message and send it to the switch.
   return swtch->m_handler->SendMessage (ofs::PacketFromMsg (msg, xid));
 }
@@ -384,6 +420,7 @@ OFSwitch13Controller::HandleFeaturesReply (struct ofl_msg_features_reply *msg,
     {
       NS_LOG_ERROR ("This switch is already registered with this controller.");
     }
+  m_localSwMap.erase (swtch->m_dpId);
 
   // Execute any pending command for this OpenFlow datapath ID.
   auto it = m_commandsMap.find (swtch->m_dpId);
@@ -561,12 +598,19 @@ OFSwitch13Controller::ReceiveFromSwitch (Ptr<Packet> packet, Address from)
 {
   NS_LOG_FUNCTION (this << packet);
 
+  ReceiveBufferFromSwitch (ofs::BufferFromPacket (packet, packet->GetSize ()), from);
+}
+
+void
+OFSwitch13Controller::ReceiveBufferFromSwitch (struct ofpbuf *buffer, Address from)
+{
+  NS_LOG_FUNCTION (this << from);
+
   uint32_t xid;
   struct ofl_msg_header *msg;
   ofl_err error;
 
-  // Get the openflow buffer, unpack the message and send to message handler
-  struct ofpbuf *buffer = ofs::BufferFromPacket (packet, packet->GetSize ());
+  // Unpack the message and send to message handler
   error = ofl_msg_unpack ((uint8_t *) buffer->data, buffer->size, &msg, &xid, 0);
 
   if (!error)
@@ -658,6 +702,54 @@ OFSwitch13Controller::SocketAccept (Ptr<Socket> socket, const Address &from)
   SendToSwitch (swtch, &hello);
 }
 
+void
+OFSwitch13Controller::StartDirectSwitchConnection (Address swAddr, Address localAddr,
+                                                   Time latency, ofs::DirectCallback swRecv)
+{
+  NS_LOG_FUNCTION (this << swAddr << localAddr << latency);
+
+  Ipv4Address ipAddr = InetSocketAddress::ConvertFrom (swAddr).GetIpv4 ();
+  NS_LOG_INFO ("Switch directly connected from " << ipAddr);
+
+  Ptr<RemoteSwitch> swtch = Create<RemoteSwitch> ();
+  swtch->m_address = swAddr;
+  swtch->m_ctrlApp = Ptr<OFSwitch13Controller> (this);
+  swtch->m_direct = swRecv;
+  swtch->m_localAddress = localAddr;
+  swtch->m_latency = latency;
+
+  std::pair<Address, Ptr<RemoteSwitch>> entry (swtch->m_address, swtch);
+  auto ret = m_addrSwMap.insert (entry);
+  if (ret.second == false)
+    {
+      NS_LOG_ERROR ("This switch is already registered with this controller.");
+    }
+
+  // As for socket connections, the handshake starts with the hello messages.
+  struct ofl_msg_header hello;
+  hello.type = OFPT_HELLO;
+  SendToSwitch (swtch, &hello);
+}
+
+void
+OFSwitch13Controller::AttachLocalSwitch (Ptr<OFSwitch13Device> device)
+{
+  NS_LOG_FUNCTION (this << device);
+
+  Ptr<RemoteSwitch> swtch = Create<RemoteSwitch> ();
+  swtch->m_address = InetSocketAddress (Ipv4Address::GetAny (), 0);
+  swtch->m_ctrlApp = Ptr<OFSwitch13Controller> (this);
+  swtch->m_dpId = device->GetDatapathId ();
+  swtch->m_local = MakeCallback (&OFSwitch13Device::ReceiveBufferLocally, device);
+
+  std::pair<uint64_t, Ptr<RemoteSwitch>> entry (swtch->m_dpId, swtch);
+  auto ret = m_localSwMap.insert (entry);
+  if (ret.second == false)
+    {
+      NS_LOG_ERROR ("This switch is already attached to this controller.");
+    }
+}
+
 void
 OFSwitch13Controller::SocketPeerClose (Ptr<Socket> socket)
 {
@@ -679,7 +771,7 @@ OFSwitch13Controller::SocketPeerError (Ptr<Socket> socket)
 }
 
 OFSwitch13Controller::RemoteSwitch::RemoteSwitch ()
-    : m_handler (0), m_ctrlApp (0), m_dpId (0), m_role (OFPCR_ROLE_EQUAL)
+    : m_handler (0), m_latency (0), m_ctrlApp (0), m_dpId (0), m_role (OFPCR_ROLE_EQUAL)
 {
   m_address = Address ();
 }
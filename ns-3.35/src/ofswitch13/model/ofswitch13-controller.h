@@ -29,6 +29,8 @@
 
 namespace ns3 {
 
+class OFSwitch13Device;
+
 /**
  * \ingroup ofswitch13
  * OpenFlow 1.3 controller base class that can handle a collection of OpenFlow
@@ -76,6 +78,10 @@ protected:
   private:
     Ptr<OFSwitch13SocketHandler> m_handler; //!< Socket handler.
     Address m_address; //!< Switch connection address.
+    ofs::DirectCallback m_direct; //!< Switch receiver, for direct connections.
+    Address m_localAddress; //!< Controller address, for direct connections.
+    Time m_latency; //!< Channel latency, for direct connections.
+    Callback<void, struct ofpbuf *> m_local; //!< Switch receiver, for local switches.
     Ptr<OFSwitch13Controller> m_ctrlApp; //!< Controller application.
     uint64_t m_dpId; //!< OpenFlow datapath ID.
     enum ofp_controller_role m_role; //!< Controller role over switch.
@@ -191,6 +197,32 @@ public:
    */
   static void DpctlSendAndPrint (struct vconn *vconn, struct ofl_msg_header *msg);
 
+  /**
+   * Accept a direct connection from a switch on the same simulation.
+   * OpenFlow messages are delivered by scheduled calls, without sockets.
+   * \param swAddr The switch address, identifying the connection.
+   * \param localAddr The controller address, as seen by the switch.
+   * \param latency The channel latency.
+   * \param swRecv The switch receiver for this controller messages.
+   */
+  void StartDirectSwitchConnection (Address swAddr, Address localAddr, Time latency,
+                                    ofs::DirectCallback swRecv);
+
+  /**
+   * Receive an OpenFlow buffer from a switch over a direct connection.
+   * \param buffer The buffer with the OpenFlow message, deleted here.
+   * \param from The switch address.
+   */
+  void ReceiveBufferFromSwitch (struct ofpbuf *buffer, Address from);
+
+  /**
+   * Attach a switch on the same simulation before it connects. Until the
+   * switch connects, dpctl commands for its datapath are applied to the
+   * datapath at once, instead of waiting for the handshake.
+   * \param device The switch device.
+   */
+  void AttachLocalSwitch (Ptr<OFSwitch13Device> device);
+
   static uint32_t DpId2Id (uint64_t DpId);
   static uint64_t Id2DpId (uint32_t Id);
 
@@ -374,6 +406,7 @@ private:
   DpIdCmdMap_t m_commandsMap; //!< Commands scheduled for execution.
   AddrSwMap_t m_addrSwMap; //!< Registered switches by address.
   DpIdSwMap_t m_dpIdSwMap; //!< Registered switches by datapath id.
+  DpIdSwMap_t m_localSwMap; //!< Local switches not yet connected, by datapath id.
 };
 
 } // namespace ns3
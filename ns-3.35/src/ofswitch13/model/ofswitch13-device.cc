@@ -443,6 +443,17 @@ OFSwitch13Device::GetPortNoConnectedTo (Ptr<Node> node)
   return -1;
 }
 
+Ptr<Node>
+OFSwitch13Device::GetNodeConnectedTo (uint32_t portNo)
+{
+  for (auto &port : m_portsNo)
+    {
+      if (port.second == portNo)
+        return port.first;
+    }
+  return 0;
+}
+
 void
 OFSwitch13Device::ReceiveFromSwitchPort (Ptr<Packet> packet, uint32_t portNo, uint64_t tunnelId)
 {
@@ -506,6 +517,45 @@ OFSwitch13Device::StartControllerConnection (Address ctrlAddr)
   m_controllers.push_back (remoteCtrl);
 }
 
+void
+OFSwitch13Device::StartDirectControllerConnection (Address ctrlAddr, Address localAddr,
+                                                   Time latency, ofs::DirectCallback ctrlRecv)
+{
+  NS_LOG_FUNCTION (this << ctrlAddr << localAddr << latency);
+
+  NS_ASSERT_MSG (!GetRemoteController (ctrlAddr), "Controller address already in use.");
+
+  // The connection is up at once, there is no socket to wait for.
+  Ptr<RemoteController> remoteCtrl = Create<RemoteController> ();
+  remoteCtrl->m_address = ctrlAddr;
+  remoteCtrl->m_remote = remote_create (m_datapath, 0, 0);
+  remoteCtrl->m_direct = ctrlRecv;
+  remoteCtrl->m_localAddress = localAddr;
+  remoteCtrl->m_latency = latency;
+  m_controllers.push_back (remoteCtrl);
+
+  SendHello (remoteCtrl);
+}
+
+void
+OFSwitch13Device::ReceiveBufferLocally (struct ofpbuf *buffer)
+{
+  NS_LOG_FUNCTION (this);
+
+  // The library handlers need a sender, so a temporary controller is
+  // registered for this message alone.
+  Ptr<RemoteController> remoteCtrl = Create<RemoteController> ();
+  remoteCtrl->m_address = InetSocketAddress (Ipv4Address::GetAny (), 0);
+  remoteCtrl->m_remote = remote_create (m_datapath, 0, 0);
+  m_controllers.push_back (remoteCtrl);
+
+  ReceiveBufferFromController (buffer, remoteCtrl->m_address);
+
+  m_controllers.erase (std::find (m_controllers.begin (), m_controllers.end (), remoteCtrl));
+  list_remove (&remoteCtrl->m_remote->node);
+  free (remoteCtrl->m_remote);
+}
+
 // ofsoftswitch13 overriding and callback functions.
 void
 OFSwitch13Device::SendPacketToController (struct pipeline *pl, struct packet *pkt, uint8_t tableId,
@@ -519,9 +569,18 @@ int
 OFSwitch13Device::SendOpenflowBufferToRemote (struct ofpbuf *buffer, struct remote *remote)
 {
   Ptr<OFSwitch13Device> dev = OFSwitch13Device::GetDevice (remote->dp->id);
-  Ptr<Packet> packet = ofs::PacketFromBuffer (buffer);
   Ptr<RemoteController> remoteCtrl = dev->GetRemoteController (remote);
 
+  // Direct connections take the buffer as is.
+  if (!remoteCtrl->m_direct.IsNull ())
+    {
+      ofs::ScheduleDirect (remoteCtrl->m_latency, remoteCtrl->m_direct, buffer,
+                           remoteCtrl->m_localAddress);
+      return 0;
+    }
+
+  Ptr<Packet> packet = ofs::PacketFromBuffer (buffer);
+
   ofpbuf_delete (buffer);
   return dev->SendToController (packet, remoteCtrl);
 }
@@ -1018,6 +1077,14 @@ OFSwitch13Device::ReceiveFromController (Ptr<Packet> packet, Address from)
 {
   NS_LOG_FUNCTION (this << packet << from);
 
+  ReceiveBufferFromController (ofs::BufferFromPacket (packet, packet->GetSize ()), from);
+}
+
+void
+OFSwitch13Device::ReceiveBufferFromController (struct ofpbuf *buffer, Address from)
+{
+  NS_LOG_FUNCTION (this << from);
+
   struct ofl_msg_header *msg;
   ofl_err error;
 
@@ -1028,8 +1095,7 @@ OFSwitch13Device::ReceiveFromController (Ptr<Packet> packet, Address from)
   senderCtrl.remote = remoteCtrl->m_remote;
   senderCtrl.conn_id = 0; // TODO No support for auxiliary connections
 
-  // Get the OpenFlow buffer and unpack the message.
-  struct ofpbuf *buffer = ofs::BufferFromPacket (packet, packet->GetSize ());
+  // Unpack the message.
   error = ofl_msg_unpack ((uint8_t *) buffer->data, buffer->size, &msg, &senderCtrl.xid,
                           m_datapath->exp);
 
@@ -1274,6 +1340,14 @@ OFSwitch13Device::SocketCtrlSucceeded (Ptr<Socket> socket)
   remoteCtrl->m_handler->SetReceiveCallback (
       MakeCallback (&OFSwitch13Device::ReceiveFromController, this));
 
+  SendHello (remoteCtrl);
+}
+
+void
+OFSwitch13Device::SendHello (Ptr<RemoteController> remoteCtrl)
+{
+  NS_LOG_FUNCTION (this);
+
   // Send the OpenFlow Hello message.
   struct ofl_msg_header msg;
   msg.type = OFPT_HELLO;
@@ -1559,7 +1633,8 @@ OFSwitch13Device::UnregisterDatapath (uint64_t id)
   NS_ABORT_MSG ("Error when removing datapath.");
 }
 
-OFSwitch13Device::RemoteController::RemoteController () : m_socket (0), m_handler (0), m_remote (0)
+OFSwitch13Device::RemoteController::RemoteController ()
+    : m_socket (0), m_handler (0), m_remote (0), m_latency (0)
 {
   m_address = Address ();
 }
@@ -70,6 +70,11 @@ private:
     Ptr<OFSwitch13SocketHandler> m_handler; //!< Socket handler.
     Address m_address; //!< Controller address.
     struct remote *m_remote; //!< Library remote struct.
+
+    // Direct connection, without socket.
+    ofs::DirectCallback m_direct; //!< Controller receiver.
+    Address m_localAddress; //!< Switch address for this controller.
+    Time m_latency; //!< Channel latency.
   }; // Class RemoteController
 
   /**
@@ -224,6 +229,11 @@ public:
 
   uint32_t GetPortNoConnectedTo (Ptr<Node> node);
 
+  /**
+   * \return The node at the other end of a port, or 0 if there is none.
+   */
+  Ptr<Node> GetNodeConnectedTo (uint32_t portNo);
+
   /**
    * Called when a packet is received on one of the switch's ports. This method
    * will schedule the packet for OpenFlow pipeline.
@@ -240,6 +250,33 @@ public:
    */
   void StartControllerConnection (Address ctrlAddr);
 
+  /**
+   * Starts a direct connection between this switch and a controller on the
+   * same simulation. OpenFlow messages are delivered by scheduled calls,
+   * without sockets.
+   * \param ctrlAddr The controller address, identifying the connection.
+   * \param localAddr The switch address, as seen by the controller.
+   * \param latency The channel latency.
+   * \param ctrlRecv The controller receiver for this switch messages.
+   */
+  void StartDirectControllerConnection (Address ctrlAddr, Address localAddr, Time latency,
+                                        ofs::DirectCallback ctrlRecv);
+
+  /**
+   * Receive an OpenFlow buffer from controller over a direct connection.
+   * \param buffer The buffer with the OpenFlow message, deleted here.
+   * \param from The controller address.
+   */
+  void ReceiveBufferFromController (struct ofpbuf *buffer, Address from);
+
+  /**
+   * Process an OpenFlow buffer at once, as if received from a controller,
+   * without any connection. Used to preinstall the flow tables before the
+   * simulation starts. Replies to this message are discarded.
+   * \param buffer The buffer with the OpenFlow message, deleted here.
+   */
+  void ReceiveBufferLocally (struct ofpbuf *buffer);
+
   /**
    * Overriding ofsoftswitch13 send_packet_to_controller weak function
    * from udatapath/pipeline.c. Sends the given packet to controller(s) in a
@@ -468,6 +505,12 @@ private:
    */
   void SocketCtrlSucceeded (Ptr<Socket> socket);
 
+  /**
+   * Send the OpenFlow Hello message to a connected controller.
+   * \param remoteCtrl The remote controller object.
+   */
+  void SendHello (Ptr<OFSwitch13Device::RemoteController> remoteCtrl);
+
   /**
    * Socket callback fired when a TCP connection to controller fail.
    * \param socket The TCP socket.
@@ -107,6 +107,39 @@ PacketFromBuffer (struct ofpbuf *buffer)
   return Create<Packet> ((uint8_t *) buffer->data, buffer->size);
 }
 
+struct ofpbuf *
+BufferFromMsg (struct ofl_msg_header *msg, uint32_t xid)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  uint8_t *buf;
+  size_t buf_size;
+  struct ofpbuf *buffer;
+
+  if (ofl_msg_pack (msg, xid, &buf, &buf_size, 0))
+    {
+      return 0;
+    }
+  buffer = ofpbuf_new (0);
+  ofpbuf_use (buffer, buf, buf_size);
+  ofpbuf_put_uninit (buffer, buf_size);
+  return buffer;
+}
+
+static void
+DeliverDirect (DirectCallback receiver, struct ofpbuf *buffer, Address from)
+{
+  receiver (buffer, from);
+}
+
+void
+ScheduleDirect (Time delay, DirectCallback receiver, struct ofpbuf *buffer, Address from)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  Simulator::Schedule (delay, &DeliverDirect, receiver, buffer, from);
+}
+
 } // namespace ofs
 } // namespace ns3
 
@@ -148,6 +148,33 @@ Ptr<Packet> PacketFromMsg (struct ofl_msg_header *msg, uint32_t xid = 0);
  */
 Ptr<Packet> PacketFromBuffer (struct ofpbuf *buffer);
 
+/**
+ * \ingroup ofswitch13
+ * Create an internal ofsoftswitch13 buffer from internal OFLib message,
+ * packing the message using wire format.
+ * \param msg The OFLib message structure.
+ * \param xid The transaction id to use.
+ * \return The OpenFlow buffer created, or 0 if the message cannot be packed.
+ */
+struct ofpbuf *BufferFromMsg (struct ofl_msg_header *msg, uint32_t xid = 0);
+
+/**
+ * \ingroup ofswitch13
+ * Receiver of the OpenFlow messages sent over a direct channel, taking
+ * ownership of the buffer. The address identifies the sender.
+ */
+typedef Callback<void, struct ofpbuf *, Address> DirectCallback;
+
+/**
+ * \ingroup ofswitch13
+ * Deliver an OpenFlow buffer over a direct channel, after a delay.
+ * \param delay The channel latency.
+ * \param receiver The receiver of the buffer.
+ * \param buffer The OpenFlow buffer, owned by the receiver from now on.
+ * \param from The address of the sender.
+ */
+void ScheduleDirect (Time delay, DirectCallback receiver, struct ofpbuf *buffer, Address from);
+
 } // namespace ofs
 } // namespace ns3
 #endif /* OFSWITCH13_INTERFACE_H */
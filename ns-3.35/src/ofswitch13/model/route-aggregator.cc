@@ -0,0 +1,233 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "route-aggregator.h"
+#include <algorithm>
+#include "ns3/abort.h"
+
+namespace ns3 {
+
+RouteAggregator::RouteAggregator (bool compact)
+    : m_compact (compact), m_nRoutes (0), m_dirty (false)
+{
+  m_root.routed = false;
+  m_root.hop = NO_HOP;
+}
+
+RouteAggregator::~RouteAggregator ()
+{
+}
+
+void
+RouteAggregator::SetRoute (Ipv4Address network, uint8_t length, uint32_t hop)
+{
+  uint32_t addr = network.Get ();
+  NS_ABORT_MSG_IF (length > 32 || (length < 32 && addr << length),
+                   "RouteAggregator: invalid prefix " << network << "/" << +length);
+  NS_ABORT_MSG_IF (hop == NO_HOP, "RouteAggregator: NO_HOP is not a next hop");
+
+  TrieNode *node = &m_root;
+  for (uint8_t i = 0; i < length; i++)
+    {
+      std::unique_ptr<TrieNode> &child = node->child[(addr >> (31 - i)) & 1];
+      if (!child)
+        {
+          child.reset (new TrieNode ());
+          child->routed = false;
+          child->hop = NO_HOP;
+        }
+      node = child.get ();
+    }
+
+  if (!node->routed)
+    m_nRoutes++;
+  m_dirty |= !node->routed || node->hop != hop;
+  node->routed = true;
+  node->hop = hop;
+}
+
+void
+RouteAggregator::RemoveRoute (Ipv4Address network, uint8_t length)
+{
+  uint32_t addr = network.Get ();
+  std::vector<TrieNode *> path (1, &m_root);
+  for (uint8_t i = 0; i < length && path.back (); i++)
+    path.push_back (path.back ()->child[(addr >> (31 - i)) & 1].get ());
+
+  TrieNode *node = path.back ();
+  if (!node || !node->routed)
+    return;
+
+  node->routed = false;
+  m_nRoutes--;
+  m_dirty = true;
+
+  // Prune the branch left without routes
+  for (uint8_t i = length; i > 0; i--)
+    {
+      TrieNode *n = path[i];
+      if (n->routed || n->child[0] || n->child[1])
+        break;
+      path[i - 1]->child[(addr >> (32 - i)) & 1].reset ();
+    }
+}
+
+void
+RouteAggregator::Clear (void)
+{
+  m_root.child[0].reset ();
+  m_root.child[1].reset ();
+  m_root.routed = false;
+  m_nRoutes = 0;
+  m_dirty = true;
+}
+
+uint32_t
+RouteAggregator::GetNRoutes (void) const
+{
+  return m_nRoutes;
+}
+
+std::vector<RouteAggregator::Rule>
+RouteAggregator::GetRules (void)
+{
+  Compile ();
+  return m_rules;
+}
+
+void
+RouteAggregator::Update (std::vector<Rule> &removed, std::vector<Rule> &added)
+{
+  Compile ();
+
+  std::map<std::pair<uint32_t, uint8_t>, uint32_t> installed;
+  for (const Rule &rule : m_rules)
+    {
+      std::pair<uint32_t, uint8_t> prefix (rule.network.Get (), rule.length);
+      installed[prefix] = rule.hop;
+
+      auto it = m_installed.find (prefix);
+      if (it == m_installed.end () || it->second != rule.hop)
+        added.push_back (rule);
+    }
+
+  for (auto &prefix : m_installed)
+    {
+      if (!installed.count (prefix.first))
+        removed.push_back ({Ipv4Address (prefix.first.first), prefix.first.second, prefix.second});
+    }
+
+  m_installed.swap (installed);
+}
+
+RouteAggregator::HopSet
+RouteAggregator::LeafHops (uint32_t hop) const
+{
+  return (hop == NO_HOP && m_compact) ? HopSet () : HopSet (1, hop);
+}
+
+RouteAggregator::HopSet
+RouteAggregator::Merge (const HopSet &a, const HopSet &b)
+{
+  if (a.empty ())
+    return b;
+  if (b.empty ())
+    return a;
+
+  HopSet hops;
+  std::set_intersection (a.begin (), a.end (), b.begin (), b.end (), std::back_inserter (hops));
+  if (hops.empty ())
+    std::set_union (a.begin (), a.end (), b.begin (), b.end (), std::back_inserter (hops));
+  return hops;
+}
+
+bool
+RouteAggregator::Contains (const HopSet &hops, uint32_t hop)
+{
+  return hops.empty () || std::binary_search (hops.begin (), hops.end (), hop);
+}
+
+// Second pass of ORTC, the first one (pushing routes down to leaves) being
+// done on the fly through the inherited hop
+void
+RouteAggregator::Collect (TrieNode *node, uint32_t inherited)
+{
+  uint32_t hop = node->routed ? node->hop : inherited;
+  if (!node->child[0] && !node->child[1])
+    {
+      node->hops = LeafHops (hop);
+      return;
+    }
+
+  HopSet hops[2];
+  for (int b = 0; b < 2; b++)
+    {
+      if (node->child[b])
+        {
+          Collect (node->child[b].get (), hop);
+          hops[b] = node->child[b]->hops;
+        }
+      else
+        hops[b] = LeafHops (hop);
+    }
+  node->hops = Merge (hops[0], hops[1]);
+}
+
+// Third pass of ORTC, keeping the hop of the parent rule whenever possible
+void
+RouteAggregator::Select (TrieNode *node, uint32_t inherited, uint32_t parent, uint32_t network,
+                         uint8_t length, std::vector<Rule> &rules)
+{
+  uint32_t hop = node->routed ? node->hop : inherited;
+  uint32_t chosen = parent;
+  if (!Contains (node->hops, parent))
+    {
+      chosen = node->hops.front ();
+      rules.push_back ({Ipv4Address (network), length, chosen});
+    }
+
+  if (!node->child[0] && !node->child[1])
+    return;
+
+  for (uint32_t b = 0; b < 2; b++)
+    {
+      uint32_t childNetwork = network | (b << (31 - length));
+      if (node->child[b])
+        Select (node->child[b].get (), hop, chosen, childNetwork, length + 1, rules);
+      else if (!Contains (LeafHops (hop), chosen))
+        rules.push_back ({Ipv4Address (childNetwork), uint8_t (length + 1), hop});
+    }
+}
+
+void
+RouteAggregator::Compile (void)
+{
+  if (!m_dirty)
+    return;
+
+  m_rules.clear ();
+  Collect (&m_root, NO_HOP);
+  Select (&m_root, NO_HOP, NO_HOP, 0, 0, m_rules);
+  m_dirty = false;
+}
+
+} // namespace ns3
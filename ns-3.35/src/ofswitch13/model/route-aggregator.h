@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef ROUTE_AGGREGATOR_H
+#define ROUTE_AGGREGATOR_H
+
+#include <map>
+#include <memory>
+#include <vector>
+#include "ns3/ipv4-address.h"
+#include "ns3/simple-ref-count.h"
+
+namespace ns3 {
+
+/**
+ * \brief Compresses the IPv4 routes of a switch into a minimal set of
+ * longest-prefix-match rules, with the ORTC (Optimal Routing Table
+ * Constructor) algorithm of Draves et al.
+ *
+ * Routes map a prefix to a next hop, usually an output port. Addresses
+ * without a route are either kept unrouted, the rules then being equivalent
+ * to the routes (exact mode), or considered as "don't care", letting them
+ * match any rule for a smaller set (compact mode).
+ *
+ * Route changes are batched: the rules are recomputed on the next
+ * GetRules or Update, which also returns the difference with the rules
+ * previously returned, so only changed rules need to be installed.
+ */
+class RouteAggregator : public SimpleRefCount<RouteAggregator>
+{
+public:
+  /**
+   * Next hop of the addresses without a route.
+   */
+  static const uint32_t NO_HOP = UINT32_MAX;
+
+  struct Rule
+  {
+    Ipv4Address network;
+    uint8_t length;
+    uint32_t hop; //!< NO_HOP for unrouted addresses under a routed prefix
+  };
+
+  /**
+   * \param compact Whether addresses without a route may match any rule.
+   */
+  RouteAggregator (bool compact = false);
+  ~RouteAggregator ();
+
+  /**
+   * Add or replace a route, network must have no bits beyond length.
+   */
+  void SetRoute (Ipv4Address network, uint8_t length, uint32_t hop);
+  void RemoveRoute (Ipv4Address network, uint8_t length);
+  void Clear (void);
+
+  uint32_t GetNRoutes (void) const;
+
+  /**
+   * \returns The minimal rule set, to match by longest prefix, e.g. with
+   * the prefix length as priority.
+   */
+  std::vector<Rule> GetRules (void);
+
+  /**
+   * Compute the rule set and its difference with the previous one.
+   *
+   * \param removed The rules whose prefix is no longer used.
+   * \param added The rules whose prefix is new or changed hop.
+   */
+  void Update (std::vector<Rule> &removed, std::vector<Rule> &added);
+
+private:
+  typedef std::vector<uint32_t> HopSet; //!< Sorted, empty for any hop
+
+  struct TrieNode
+  {
+    std::unique_ptr<TrieNode> child[2];
+    bool routed;
+    uint32_t hop;
+    HopSet hops; //!< Candidate hops, computed by Collect
+  };
+
+  HopSet LeafHops (uint32_t hop) const;
+  void Collect (TrieNode *node, uint32_t inherited);
+  void Select (TrieNode *node, uint32_t inherited, uint32_t parent, uint32_t network,
+               uint8_t length, std::vector<Rule> &rules);
+  void Compile (void);
+
+  static HopSet Merge (const HopSet &a, const HopSet &b);
+  static bool Contains (const HopSet &hops, uint32_t hop);
+
+  bool m_compact;
+  TrieNode m_root;
+  uint32_t m_nRoutes;
+  bool m_dirty;
+  std::vector<Rule> m_rules;
+  std::map<std::pair<uint32_t, uint8_t>, uint32_t> m_installed; //!< Hop of each prefix returned
+};
+
+} // namespace ns3
+
+#endif /* ROUTE_AGGREGATOR_H */
@@ -57,7 +57,12 @@ SimpleControllerFlex::GetTypeId (void)
   static TypeId tid = TypeId ("ns3::SimpleControllerFlex")
                           .SetParent<SimpleController> ()
                           .SetGroupName ("OFSwitch13")
-                          .AddConstructor<SimpleControllerFlex> ();
+                          .AddConstructor<SimpleControllerFlex> ()
+                          .AddAttribute (
+                              "FlexThreshold", "The smallest flex change triggering a reroute.",
+                              DoubleValue (0.0),
+                              MakeDoubleAccessor (&SimpleControllerFlex::m_flexThreshold),
+                              MakeDoubleChecker<double> (0.0));
   return tid;
 }
 
@@ -65,12 +70,28 @@ void
 SimpleControllerFlex::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  if (!m_isFirstUpdate)
+    EnergyAPI::Unsubscribe (m_flexSubscription);
   SimpleController::DoDispose ();
 }
 
+void
+SimpleControllerFlex::ResolveFlexSeries ()
+{
+  m_flexIds.resize (EnergyAPI::GetNRegions ());
+  for (uint32_t region = 0; region < m_flexIds.size (); region++)
+    m_flexIds[region] = EnergyAPI::GetRegionFlexId (region);
+}
+
 void
 SimpleControllerFlex::UpdateWeights ()
 {
+  if (m_flexIds.empty ())
+    ResolveFlexSeries ();
+
+  // One value per energy region, shared by all its switches
+  EnergyAPI::GetFlexValues (m_flexIds, Simulator::Now (), m_flexValues);
+
   Graph topo = Topology::GetGraph ();
 
   boost::graph_traits<Graph>::edge_iterator edgeIt, edgeEnd;
@@ -82,9 +103,8 @@ SimpleControllerFlex::UpdateWeights ()
 
       if (n1->IsSwitch () && n2->IsSwitch ())
         {
-          int index = int (Simulator::Now ().GetMinutes ()) % 60;
-          float flex1 = EnergyAPI::GetFlexArray (Names::FindName (n1)).at (index);
-          float flex2 = EnergyAPI::GetFlexArray (Names::FindName (n2)).at (index);
+          float flex1 = m_flexValues[EnergyAPI::GetNodeRegion (n1->GetId ())];
+          float flex2 = m_flexValues[EnergyAPI::GetNodeRegion (n2->GetId ())];
 
           Topology::UpdateEdgeWeight (n1, n2, flex1 + flex2);
         }
@@ -98,8 +118,26 @@ SimpleControllerFlex::UpdateRouting ()
   NodeContainer switches = NodeContainer::GetGlobalSwitches ();
   for (auto sw = switches.Begin (); sw != switches.End (); sw++)
     ApplyRouting (Id2DpId ((*sw)->GetId ()));
+}
+
+void
+SimpleControllerFlex::FlexChanged (const std::vector<EnergyAPI::SeriesId> &changed)
+{
+  NS_LOG_FUNCTION (this << changed.size ());
+  UpdateRouting ();
+}
 
-  Simulator::Schedule (Minutes (1), &SimpleControllerFlex::UpdateRouting, this);
+void
+SimpleControllerFlex::StartFlexUpdates ()
+{
+  if (!m_isFirstUpdate)
+    return;
+
+  UpdateWeights ();
+  m_isFirstUpdate = false;
+  // Reroute only when a flex value changes
+  m_flexSubscription = EnergyAPI::SubscribeFlex (
+      m_flexIds, MakeCallback (&SimpleControllerFlex::FlexChanged, this), m_flexThreshold);
 }
 
 void
@@ -107,21 +145,17 @@ SimpleControllerFlex::HandshakeSuccessful (Ptr<const RemoteSwitch> sw)
 {
   NS_LOG_FUNCTION (this << sw);
 
-  uint64_t swDpId = sw->GetDpId ();
-
-  // Default rules
-  DpctlExecute (swDpId, "flow-mod cmd=add,table=0,prio=0 "
-                        "apply:output=ctrl:128");
-  DpctlExecute (swDpId, "set-config miss=128");
+  StartFlexUpdates ();
+  SimpleController::HandshakeSuccessful (sw);
+}
 
-  if (m_isFirstUpdate)
-    {
-      UpdateWeights ();
-      m_isFirstUpdate = false;
-      Simulator::Schedule (Minutes (1), &SimpleControllerFlex::UpdateRouting, this);
-    }
+void
+SimpleControllerFlex::Preinstall (void)
+{
+  NS_LOG_FUNCTION (this);
 
-  ApplyRouting (swDpId);
+  StartFlexUpdates ();
+  SimpleController::Preinstall ();
 }
 
 } // namespace ns3
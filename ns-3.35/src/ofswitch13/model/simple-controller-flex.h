@@ -24,6 +24,7 @@
 #define SIMPLE_CONTROLLER_FLEX_H
 
 #include "simple-controller.h"
+#include "ns3/energy-api.h"
 
 namespace ns3 {
 
@@ -34,15 +35,23 @@ public:
   virtual ~SimpleControllerFlex ();
   static TypeId GetTypeId (void);
   virtual void DoDispose ();
+  virtual void Preinstall (void);
 
 protected:
   void HandshakeSuccessful (Ptr<const RemoteSwitch> sw);
 
 private:
+  void StartFlexUpdates ();
   void UpdateRouting ();
   void UpdateWeights ();
+  void FlexChanged (const std::vector<EnergyAPI::SeriesId> &changed);
+  void ResolveFlexSeries ();
 
   bool m_isFirstUpdate;
+  double m_flexThreshold; //!< Smallest flex change triggering a reroute
+  uint32_t m_flexSubscription;
+  std::vector<EnergyAPI::SeriesId> m_flexIds; //!< Flex series of each energy region
+  std::vector<float> m_flexValues; //!< Current flex of each energy region
 };
 
 } // namespace ns3
@@ -31,14 +31,16 @@
 
 NS_LOG_COMPONENT_DEFINE ("SimpleController");
 
-#define PORT_DOWN 1
-#define PORT_UP 4
-
 namespace ns3 {
 
 NS_OBJECT_ENSURE_REGISTERED (SimpleController);
 
 SimpleController::SimpleController ()
+    : m_aggregation (NONE),
+      m_routing (DESTINATION),
+      m_multipath (SHORTEST_PATH),
+      m_fastFailover (false),
+      m_linkState (Create<LinkStateDb> ())
 {
   NS_LOG_FUNCTION (this);
 }
@@ -54,7 +56,38 @@ SimpleController::GetTypeId (void)
   static TypeId tid = TypeId ("ns3::SimpleController")
                           .SetParent<OFSwitch13Controller> ()
                           .SetGroupName ("OFSwitch13")
-                          .AddConstructor<SimpleController> ();
+                          .AddConstructor<SimpleController> ()
+                          .AddAttribute ("RouteAggregation",
+                                         "How the host routes of each switch are installed.",
+                                         EnumValue (SimpleController::NONE),
+                                         MakeEnumAccessor (&SimpleController::m_aggregation),
+                                         MakeEnumChecker (SimpleController::NONE, "None",
+                                                          SimpleController::EXACT, "Exact",
+                                                          SimpleController::COMPACT, "Compact"))
+                          .AddAttribute ("Routing", "What the switches forward on.",
+                                         EnumValue (SimpleController::DESTINATION),
+                                         MakeEnumAccessor (&SimpleController::m_routing),
+                                         MakeEnumChecker (SimpleController::DESTINATION,
+                                                          "Destination", SimpleController::LABEL,
+                                                          "Label"))
+                          .AddAttribute ("Multipath", "Which next hops traffic is spread over.",
+                                         EnumValue (SimpleController::SHORTEST_PATH),
+                                         MakeEnumAccessor (&SimpleController::m_multipath),
+                                         MakeEnumChecker (SimpleController::SHORTEST_PATH,
+                                                          "ShortestPath",
+                                                          SimpleController::EQUAL_COST, "EqualCost",
+                                                          SimpleController::WEIGHTED, "Weighted"))
+                          .AddAttribute ("FastFailover",
+                                         "Back up each next hop with a fast-failover group.",
+                                         BooleanValue (false),
+                                         MakeBooleanAccessor (&SimpleController::m_fastFailover),
+                                         MakeBooleanChecker ())
+                          .AddAttribute ("RerouteDelay",
+                                         "Time link state changes are batched for before the "
+                                         "affected routes are recomputed.",
+                                         TimeValue (Seconds (0)),
+                                         MakeTimeAccessor (&SimpleController::m_rerouteDelay),
+                                         MakeTimeChecker ());
   return tid;
 }
 
@@ -62,34 +95,391 @@ void
 SimpleController::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  m_aggregators.clear ();
+  m_hostEdges.clear ();
+  m_edges.clear ();
+  m_hops.clear ();
+  m_groups.clear ();
+  m_linkState = 0;
+  m_rerouteEvent.Cancel ();
+  m_preinstalled.clear ();
   OFSwitch13Controller::DoDispose ();
 }
 
 void
 SimpleController::ApplyRouting (uint64_t swDpId)
 {
-  uint32_t swId = DpId2Id (swDpId);
-  Ptr<Node> sw = NodeContainer::GetGlobal ().Get (swId);
+  std::vector<Ptr<Node>> dsts;
+  if (m_routing == LABEL)
+    {
+      if (m_hostEdges.empty ())
+        FindHostEdges ();
+
+      // Hosts do not move, the classifier is installed once
+      if (!m_hops.count (swDpId))
+        InstallLabelClassifier (swDpId);
+      dsts.assign (m_edges.begin (), m_edges.end ());
+    }
+  else
+    {
+      NodeContainer hosts = NodeContainer::GetGlobalHosts ();
+      dsts.assign (hosts.Begin (), hosts.End ());
+    }
+
+  InstallRoutes (swDpId, dsts);
+  ReleaseGroups (swDpId);
+}
+
+void
+SimpleController::InstallRoutes (uint64_t swDpId, const std::vector<Ptr<Node>> &dsts)
+{
+  Ptr<Node> sw = NodeContainer::GetGlobal ().Get (DpId2Id (swDpId));
+  std::map<Ptr<Node>, uint32_t> &installed = m_hops[swDpId];
+  std::map<Ipv4Address, uint32_t> routes;
+
+  for (Ptr<Node> dst : dsts)
+    {
+      if (dst == sw)
+        continue;
+
+      m_linkState->ClearRoute ({swDpId, dst});
+      uint32_t hop = GetNextHop (swDpId, sw, dst);
+      auto it = installed.find (dst);
+      bool changed = it == installed.end () || it->second != hop;
+      installed[dst] = hop;
+
+      std::ostringstream cmd;
+      if (m_routing == LABEL)
+        {
+          // Only the labels whose next hop changed are sent
+          if (!changed)
+            continue;
+          cmd << "flow-mod cmd=add,table=1,prio=1 tunn_id=" << Id2DpId (dst->GetId ())
+              << " apply:" << HopAction (hop);
+        }
+      else
+        {
+          Ipv4Address remoteAddr = dst->GetObject<Ipv4> ()->GetAddress (1, 0).GetLocal ();
+          if (m_aggregation != NONE)
+            {
+              routes[remoteAddr] = hop;
+              continue;
+            }
+          cmd << "flow-mod cmd=add,table=0 eth_type=0x800,ip_dst=" << remoteAddr
+              << " apply:" << HopAction (hop);
+        }
+
+      NS_LOG_DEBUG ("[" << swDpId << "]: " << cmd.str ());
+      DpctlExecute (swDpId, cmd.str ());
+    }
+
+  if (!routes.empty ())
+    ApplyAggregatedRouting (swDpId, routes);
+}
+
+uint32_t
+SimpleController::GetNextHop (uint64_t swDpId, Ptr<Node> sw, Ptr<Node> dst)
+{
   Ptr<OFSwitch13Device> ofDevice = sw->GetObject<OFSwitch13Device> ();
+
+  std::vector<std::pair<Ptr<Node>, int>> hops;
+  if (m_multipath != SHORTEST_PATH)
+    hops = Topology::NextHops (sw, dst, m_multipath == EQUAL_COST);
+
+  if (hops.size () < 2)
+    {
+      std::vector<Ptr<Node>> path = Topology::DijkstraShortestPath (sw, dst);
+      if (path.size () < 2)
+        return RouteAggregator::NO_HOP;
+
+      m_linkState->AddPath ({swDpId, dst}, path);
+      uint32_t port = ofDevice->GetPortNoConnectedTo (path[1]);
+      if (!m_fastFailover)
+        return port;
+
+      // The backup avoids the link to the primary next hop, the next hops
+      // further down protect the rest of the path
+      std::vector<Ptr<Node>> backup = Topology::DijkstraShortestPath (sw, dst, sw, path[1]);
+      if (backup.size () < 2)
+        return port;
+
+      uint32_t backupPort = ofDevice->GetPortNoConnectedTo (backup[1]);
+      std::ostringstream buckets;
+      buckets << " weight=0,port=" << port << " output=" << port << " weight=0,port=" << backupPort
+              << " output=" << backupPort;
+      return GetGroup (swDpId, "ff", buckets.str ());
+    }
+
+  // Buckets weighted by capacity, and by the inverse of the path cost if
+  // the next hops are not all on a shortest path
+  std::vector<std::pair<uint32_t, double>> shares;
+  double maxShare = 0;
+  for (auto &hop : hops)
+    {
+      DataRateValue rate;
+      Topology::GetChannel (sw, hop.first)->GetDevice (0)->GetAttribute ("DataRate", rate);
+      double share = rate.Get ().GetBitRate ();
+      if (m_multipath == WEIGHTED)
+        share /= std::max (hop.second, 1);
+
+      shares.emplace_back (ofDevice->GetPortNoConnectedTo (hop.first), share);
+      maxShare = std::max (maxShare, share);
+
+      std::vector<Ptr<Node>> path = Topology::DijkstraShortestPath (hop.first, dst);
+      path.insert (path.begin (), sw);
+      m_linkState->AddPath ({swDpId, dst}, path);
+    }
+
+  Buckets buckets;
+  for (auto &share : shares)
+    {
+      double weight = std::round (MAX_BUCKET_WEIGHT * share.second / maxShare);
+      buckets.emplace_back (share.first, std::max<uint16_t> (weight, 1));
+    }
+  std::sort (buckets.begin (), buckets.end ());
+
+  // With fast failover, the buckets of ports going down are skipped at once
+  std::ostringstream os;
+  for (auto &bucket : buckets)
+    {
+      os << " weight=" << bucket.second;
+      if (m_fastFailover)
+        os << ",port=" << bucket.first;
+      os << " output=" << bucket.first;
+    }
+  return GetGroup (swDpId, "sel", os.str ());
+}
+
+uint32_t
+SimpleController::GetGroup (uint64_t swDpId, std::string type, std::string buckets)
+{
+  // Switches with the same next hops for several destinations share a group
+  SwitchGroups &groups = m_groups[swDpId];
+  auto it = groups.ids.find (type + buckets);
+  if (it == groups.ids.end ())
+    {
+      uint32_t groupId = ++groups.lastId;
+      it = groups.ids.insert ({type + buckets, groupId}).first;
+
+      std::ostringstream cmd;
+      cmd << "group-mod cmd=add,type=" << type << ",group=" << groupId << buckets;
+
+      NS_LOG_DEBUG ("[" << swDpId << "]: " << cmd.str ());
+      DpctlExecute (swDpId, cmd.str ());
+    }
+
+  return GROUP_HOP | it->second;
+}
+
+std::string
+SimpleController::HopAction (uint32_t hop)
+{
+  std::ostringstream os;
+  if (hop == RouteAggregator::NO_HOP)
+    os << "output=ctrl:128";
+  else if (hop & GROUP_HOP)
+    os << "group=" << (hop & ~GROUP_HOP);
+  else
+    os << "output=" << hop;
+  return os.str ();
+}
+
+void
+SimpleController::ReleaseGroups (uint64_t swDpId)
+{
+  auto groups = m_groups.find (swDpId);
+  if (groups == m_groups.end ())
+    return;
+
+  std::set<uint32_t> used;
+  for (auto &hop : m_hops[swDpId])
+    {
+      if (hop.second != RouteAggregator::NO_HOP && hop.second & GROUP_HOP)
+        used.insert (hop.second & ~GROUP_HOP);
+    }
+
+  // No rule points to the groups no installed hop uses
+  for (auto it = groups->second.ids.begin (); it != groups->second.ids.end ();)
+    {
+      if (used.count (it->second))
+        {
+          it++;
+          continue;
+        }
+
+      std::ostringstream cmd;
+      cmd << "group-mod cmd=del,group=" << it->second;
+
+      NS_LOG_DEBUG ("[" << swDpId << "]: " << cmd.str ());
+      DpctlExecute (swDpId, cmd.str ());
+      it = groups->second.ids.erase (it);
+    }
+}
+
+void
+SimpleController::ApplyAggregatedRouting (uint64_t swDpId,
+                                          const std::map<Ipv4Address, uint32_t> &routes)
+{
+  Ptr<RouteAggregator> &aggregator = m_aggregators[swDpId];
+  if (!aggregator)
+    aggregator = Create<RouteAggregator> (m_aggregation == COMPACT);
+
+  // Hosts are only ever added, their routes are replaced in place
+  for (auto &route : routes)
+    {
+      if (route.second == RouteAggregator::NO_HOP)
+        aggregator->RemoveRoute (route.first, 32);
+      else
+        aggregator->SetRoute (route.first, 32, route.second);
+    }
+
+  std::vector<RouteAggregator::Rule> removed, added;
+  aggregator->Update (removed, added);
+
+  // Longest prefix first through the priority, above the table-miss rule
+  auto match = [] (const RouteAggregator::Rule &rule) {
+    std::ostringstream os;
+    os << "table=0,prio=" << rule.length + 1 << " eth_type=0x800";
+    if (rule.length)
+      os << ",ip_dst=" << rule.network << "/" << +rule.length;
+    return os.str ();
+  };
+
+  for (const RouteAggregator::Rule &rule : removed)
+    {
+      std::string cmd = "flow-mod cmd=dels," + match (rule);
+      NS_LOG_DEBUG ("[" << swDpId << "]: " << cmd);
+      DpctlExecute (swDpId, cmd);
+    }
+
+  for (const RouteAggregator::Rule &rule : added)
+    {
+      std::ostringstream cmd;
+      cmd << "flow-mod cmd=add," << match (rule) << " apply:" << HopAction (rule.hop);
+
+      NS_LOG_DEBUG ("[" << swDpId << "]: " << cmd.str ());
+      DpctlExecute (swDpId, cmd.str ());
+    }
+
+  NS_LOG_INFO ("[" << swDpId << "]: " << aggregator->GetNRoutes () << " routes in "
+                   << aggregator->GetRules ().size () << " rules");
+}
+
+void
+SimpleController::FindHostEdges (void)
+{
   NodeContainer hosts = NodeContainer::GetGlobalHosts ();
+  NodeContainer switches = NodeContainer::GetGlobalSwitches ();
 
-  for (NodeContainer::Iterator i = hosts.Begin (); i != hosts.End (); i++)
+  for (NodeContainer::Iterator sw = switches.Begin (); sw != switches.End (); sw++)
     {
-      Ipv4Address remoteAddr = (*i)->GetObject<Ipv4> ()->GetAddress (1, 0).GetLocal ();
-      std::vector<Ptr<Node>> path = Topology::DijkstraShortestPath (sw, *i);
+      Ptr<OFSwitch13Device> ofDevice = (*sw)->GetObject<OFSwitch13Device> ();
+      for (NodeContainer::Iterator h = hosts.Begin (); h != hosts.End (); h++)
+        {
+          if (ofDevice->GetPortNoConnectedTo (*h) != (uint32_t) -1)
+            {
+              m_hostEdges[*h] = *sw;
+              m_edges.insert (*sw);
+            }
+        }
+    }
+}
+
+/*
+ * Label routing uses two tables. Table 0 delivers to the local hosts and
+ * classifies the other packets by destination, setting the tunnel id to the
+ * datapath ID of their egress switch. Table 1 forwards on the tunnel id
+ * alone, so only it changes when routes do. The tunnel id travels between
+ * switches in a TunnelIdTag, adding no header.
+ */
+void
+SimpleController::InstallLabelClassifier (uint64_t swDpId)
+{
+  Ptr<Node> sw = NodeContainer::GetGlobal ().Get (DpId2Id (swDpId));
+  Ptr<OFSwitch13Device> ofDevice = sw->GetObject<OFSwitch13Device> ();
+  NodeContainer hosts = NodeContainer::GetGlobalHosts ();
+
+  DpctlExecute (swDpId, "flow-mod cmd=add,table=1,prio=0 apply:output=ctrl:128");
+
+  // Labelled packets, and those classified below, go straight to table 1
+  DpctlExecute (swDpId, "flow-mod cmd=add,table=0,prio=1 eth_type=0x800 goto:1");
 
-      uint32_t port = ofDevice->GetPortNoConnectedTo (path.at (1));
+  // One rule per remote edge switch, if the hosts were addressed per switch
+  for (const Topology::Prefix &prefix : Topology::GetPrefixes ())
+    {
+      if (prefix.sw == sw)
+        continue;
 
       std::ostringstream cmd;
-      cmd << "flow-mod cmd=add,table=0 eth_type=0x800,ip_dst=" << remoteAddr
-          << " apply:output=" << port;
+      cmd << "flow-mod cmd=add,table=0,prio=2 eth_type=0x800,tunn_id=0,ip_dst=" << prefix.network
+          << "/" << prefix.mask.GetPrefixLength ()
+          << " apply:set_field=tunn_id:" << Id2DpId (prefix.sw->GetId ()) << " goto:1";
 
       NS_LOG_DEBUG ("[" << swDpId << "]: " << cmd.str ());
+      DpctlExecute (swDpId, cmd.str ());
+    }
 
+  for (NodeContainer::Iterator i = hosts.Begin (); i != hosts.End (); i++)
+    {
+      Ipv4Address remoteAddr = (*i)->GetObject<Ipv4> ()->GetAddress (1, 0).GetLocal ();
+      Ptr<Node> edge = m_hostEdges[*i];
+
+      std::ostringstream cmd;
+      if (edge == sw)
+        {
+          // Egress, the label is popped
+          cmd << "flow-mod cmd=add,table=0,prio=3 eth_type=0x800,ip_dst=" << remoteAddr
+              << " apply:set_field=tunn_id:0,output=" << ofDevice->GetPortNoConnectedTo (*i);
+        }
+      else if (!Topology::GetPrefixSwitch (remoteAddr))
+        {
+          cmd << "flow-mod cmd=add,table=0,prio=2 eth_type=0x800,tunn_id=0,ip_dst=" << remoteAddr
+              << " apply:set_field=tunn_id:" << Id2DpId (edge->GetId ()) << " goto:1";
+        }
+      else
+        continue;
+
+      NS_LOG_DEBUG ("[" << swDpId << "]: " << cmd.str ());
       DpctlExecute (swDpId, cmd.str ());
     }
 }
 
+void
+SimpleController::ScheduleReroute (const LinkStateDb::RouteSet &routes)
+{
+  if (m_pendingRoutes.size () < routes.size ())
+    m_pendingRoutes.resize (routes.size ());
+  m_pendingRoutes |= routes;
+
+  if (!m_rerouteEvent.IsRunning ())
+    m_rerouteEvent = Simulator::Schedule (m_rerouteDelay, &SimpleController::Reroute, this);
+}
+
+void
+SimpleController::Reroute (void)
+{
+  // Only the destinations whose path used the links are recomputed, once
+  // however often the links flapped
+  std::map<uint64_t, std::vector<Ptr<Node>>> dsts;
+  for (size_t i = m_pendingRoutes.find_first (); i != m_pendingRoutes.npos;
+       i = m_pendingRoutes.find_next (i))
+    {
+      LinkStateDb::Route route = m_linkState->GetRoute (i);
+      dsts[route.first].push_back (route.second);
+    }
+
+  NS_LOG_INFO ("Recomputing " << m_pendingRoutes.count () << " of "
+                              << m_linkState->GetNRoutes () << " routes in " << dsts.size ()
+                              << " switches");
+  m_pendingRoutes.clear ();
+
+  for (auto &sw : dsts)
+    {
+      InstallRoutes (sw.first, sw.second);
+      ReleaseGroups (sw.first);
+    }
+}
+
 void
 SimpleController::HandshakeSuccessful (Ptr<const RemoteSwitch> sw)
 {
@@ -97,12 +487,37 @@ SimpleController::HandshakeSuccessful (Ptr<const RemoteSwitch> sw)
 
   uint64_t swDpId = sw->GetDpId ();
 
-  // Default rules
+  if (m_preinstalled.count (swDpId))
+    return;
+
+  InstallDefaultRules (swDpId);
+  ApplyRouting (swDpId);
+}
+
+void
+SimpleController::InstallDefaultRules (uint64_t swDpId)
+{
   DpctlExecute (swDpId, "flow-mod cmd=add,table=0,prio=0 "
                         "apply:output=ctrl:128");
   DpctlExecute (swDpId, "set-config miss=128");
+}
 
-  ApplyRouting (swDpId);
+void
+SimpleController::Preinstall (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  NodeContainer switches = NodeContainer::GetGlobalSwitches ();
+  for (auto sw = switches.Begin (); sw != switches.End (); sw++)
+    {
+      uint64_t swDpId = Id2DpId ((*sw)->GetId ());
+
+      // The commands are applied at once, until the switch connects
+      AttachLocalSwitch (OFSwitch13Device::GetDevice (swDpId));
+      InstallDefaultRules (swDpId);
+      ApplyRouting (swDpId);
+      m_preinstalled.insert (swDpId);
+    }
 }
 
 ofl_err
@@ -120,17 +535,16 @@ SimpleController::HandlePortStatus (struct ofl_msg_port_status *msg, Ptr<const R
 
   if (reason == OFPPR_MODIFY)
     {
-      // FIXME: port.state is a bitmap. This needs to be properly checked
-      switch (port.state)
+      Ptr<Node> peer = sw->GetObject<OFSwitch13Device> ()->GetNodeConnectedTo (port.port_no);
+      bool up = !(port.state & OFPPS_LINK_DOWN) && !(port.config & OFPPC_PORT_DOWN);
+      NS_LOG_INFO (Names::FindName (sw) << " port nº" << port.port_no << (up ? " up" : " down"));
+
+      if (peer && m_linkState->ReportPort (sw, peer, up))
         {
-        case PORT_DOWN:
-          std::cout << Names::FindName (sw) << " port nº" << port.port_no << " DOWN" << std::endl;
-          break;
-        case PORT_UP:
-          std::cout << Names::FindName (sw) << " port nº" << port.port_no << " UP" << std::endl;
-          break;
-        default:
-          NS_LOG_DEBUG ("Unknow Port State received");
+          LinkStateDb::Link link = LinkStateDb::GetLink (sw, peer);
+          NS_LOG_INFO ("Link " << Names::FindName (sw) << "-" << Names::FindName (peer)
+                               << (up ? " up" : " down"));
+          ScheduleReroute (m_linkState->GetAffectedRoutes (link));
         }
     }
   else
@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "address-planner.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/topology-module.h"
+
+namespace ns3 {
+
+using namespace std;
+
+static Ipv4Mask
+lengthToMask (uint32_t length)
+{
+  return Ipv4Mask (length ? ~uint32_t (0) << (32 - length) : 0);
+}
+
+AddressPlanner::AddressPlanner (std::string supernet, uint32_t prefixLength)
+    : m_prefixLength (prefixLength), m_nSubnets (0)
+{
+  size_t slash = supernet.find ('/');
+  NS_ABORT_MSG_IF (slash == string::npos, "Supernet " << supernet << " has no prefix length");
+
+  m_supernet = Ipv4Address (supernet.substr (0, slash).c_str ());
+  m_supernetLength = stoul (supernet.substr (slash + 1));
+
+  NS_ABORT_MSG_IF (m_supernetLength > 30, "Supernet " << supernet << " is too small");
+  NS_ABORT_MSG_IF (m_supernet.CombineMask (lengthToMask (m_supernetLength)) != m_supernet,
+                   "Supernet " << supernet << " has host bits set");
+  NS_ABORT_MSG_IF (m_prefixLength < m_supernetLength || m_prefixLength > 30,
+                   "Prefix length " << m_prefixLength << " does not fit in supernet " << supernet);
+}
+
+Ipv4Address
+AddressPlanner::Assign (Ptr<NetDevice> device, Ptr<Node> edge)
+{
+  bool shared = m_prefixLength == m_supernetLength;
+  auto it = m_subnets.find (shared ? Ptr<Node> () : edge);
+
+  if (it == m_subnets.end ())
+    {
+      NS_ABORT_MSG_IF (uint64_t (m_nSubnets) >> (m_prefixLength - m_supernetLength),
+                       "No subnet left in " << m_supernet << "/" << m_supernetLength << " for "
+                                            << Names::FindName (edge));
+
+      Subnet subnet = {m_nSubnets++ << (32 - m_prefixLength), 0};
+      if (!shared)
+        Topology::AddPrefix (Ipv4Address (m_supernet.Get () + subnet.offset),
+                             lengthToMask (m_prefixLength), edge);
+      it = m_subnets.emplace (shared ? Ptr<Node> () : edge, subnet).first;
+    }
+
+  // Skips the network and broadcast addresses of the subnet
+  Subnet &subnet = it->second;
+  NS_ABORT_MSG_IF (subnet.nHosts + 2 >= uint64_t (1) << (32 - m_prefixLength),
+                   "Subnet " << Ipv4Address (m_supernet.Get () + subnet.offset) << "/"
+                             << m_prefixLength << " is full");
+  uint32_t offset = subnet.offset + ++subnet.nHosts;
+
+  Ipv4AddressHelper helper;
+  helper.SetBase (m_supernet, lengthToMask (m_supernetLength), Ipv4Address (offset));
+  return helper.Assign (NetDeviceContainer (device)).GetAddress (0);
+}
+
+} // namespace ns3
@@ -62,7 +62,7 @@ installSinker (Ptr<Node> host, string protocol, uint64_t port)
 }
 
 ApplicationContainer
-parseV4ping (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
+parseV4ping (const toml::table &configs, Ptr<Node> host, Ptr<Node> remoteHost)
 {
   V4PingHelper v4helper = V4PingHelper (getAddress (remoteHost));
   v4helper.SetAttribute ("Verbose", BooleanValue (configs["verbose"].value_or (true)));
@@ -71,7 +71,7 @@ parseV4ping (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
 }
 
 ApplicationContainer
-parseBulkSend (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
+parseBulkSend (const toml::table &configs, Ptr<Node> host, Ptr<Node> remoteHost)
 {
   Ipv4Address remoteAddress = getAddress (remoteHost);
   string protocol = protocol2factory (configs["protocol"].value_or ("TCP"));
@@ -89,7 +89,7 @@ parseBulkSend (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
 }
 
 ApplicationContainer
-parseConstSend (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
+parseConstSend (const toml::table &configs, Ptr<Node> host, Ptr<Node> remoteHost)
 {
   Ipv4Address remoteAddress = getAddress (remoteHost);
   string protocol = protocol2factory (configs["protocol"].value_or ("UDP"));
@@ -107,7 +107,7 @@ parseConstSend (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
 }
 
 ApplicationContainer
-parseSinSend (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
+parseSinSend (const toml::table &configs, Ptr<Node> host, Ptr<Node> remoteHost)
 {
   Ipv4Address remoteAddress = getAddress (remoteHost);
   string protocol = protocol2factory (configs["protocol"].value_or ("UDP"));
@@ -128,7 +128,7 @@ parseSinSend (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
 }
 
 ApplicationContainer
-parsePPBP (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
+parsePPBP (const toml::table &configs, Ptr<Node> host, Ptr<Node> remoteHost)
 {
   Ipv4Address remoteAddress = getAddress (remoteHost);
   string protocol = protocol2factory (configs["protocol"].value_or ("UDP"));
@@ -152,43 +152,25 @@ parsePPBP (toml::table configs, Ptr<Node> host, Ptr<Node> remoteHost)
 }
 
 void
-parseApps (std::string topoName)
+parseApps (const TopologySpec &spec, const NodeContainer &nodes)
 {
-  string appsFile = SystemPath::Append (topoName, "applications.toml");
-
-  NS_ABORT_MSG_IF (!SystemPath::Exists (appsFile), "applications.toml not found");
-
-  toml::table tbl;
-  try
-    {
-      tbl = toml::parse_file (appsFile);
-    }
-  catch (const toml::parse_error &err)
-    {
-      NS_ABORT_MSG ("Error parsing applications.toml" << err.description ());
-    }
-
-  for (auto pair : tbl)
+  for (const AppSpec &app : spec.apps)
     {
-      toml::table configs = *pair.second.as_table ();
-      std::string appType = configs["type"].ref<std::string> ();
-
-      Ptr<Node> host = Names::Find<Node> (configs["host"].ref<string> ());
-      Ptr<Node> remoteHost = Names::Find<Node> (configs["remote"].ref<string> ());
+      const toml::table &configs = *app.configs;
+      Ptr<Node> host = nodes.Get (app.host);
+      Ptr<Node> remoteHost = nodes.Get (app.remote);
 
       ApplicationContainer apps;
-      if (!appType.compare ("v4ping"))
+      if (app.type == "v4ping")
         apps = parseV4ping (configs, host, remoteHost);
-      else if (!appType.compare ("bulkSend"))
+      else if (app.type == "bulkSend")
         apps = parseBulkSend (configs, host, remoteHost);
-      else if (!appType.compare ("constSend"))
+      else if (app.type == "constSend")
         apps = parseConstSend (configs, host, remoteHost);
-      else if (!appType.compare ("sinSend"))
+      else if (app.type == "sinSend")
         apps = parseSinSend (configs, host, remoteHost);
-      else if (!appType.compare ("PPBP"))
-        apps = parsePPBP (configs, host, remoteHost);
       else
-        NS_ABORT_MSG ("Unknown " << appType << " application");
+        apps = parsePPBP (configs, host, remoteHost);
 
       apps.Start (Time (configs["startTime"].value_or ("1s")));
       if (configs.contains ("stopTime"))
@@ -24,10 +24,12 @@
 #define PARSE_APPS_H
 
 #include "ns3/core-module.h"
+#include "ns3/node-container.h"
+#include "parse-spec.h"
 
 namespace ns3 {
 
-void parseApps (std::string topoName);
+void parseApps (const TopologySpec &spec, const NodeContainer &nodes);
 
 } // namespace ns3
 
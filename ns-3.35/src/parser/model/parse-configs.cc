@@ -31,13 +31,46 @@ namespace ns3 {
 using namespace std;
 
 void
-parseSimConfigs (toml::table simConfigs)
+parseSimConfigs (const toml::table &simConfigs)
 {
   GlobalValue::Bind ("SimStopTime", StringValue (simConfigs["stopTime"].value_or ("60s")));
 }
 
+/**
+ * Read the windows of a collector from its aggregation table.
+ * \returns false if there is none, i.e. the raw samples are logged.
+ */
+static bool
+parseTraceWindow (const toml::table &configs, TraceWindow &window)
+{
+  const toml::node_view<const toml::node> aggregation = configs["aggregation"];
+  if (!aggregation)
+    return false;
+  NS_ABORT_MSG_IF (!aggregation.is_table (), "aggregation is not a table");
+
+  optional<string> size = aggregation["window"].value<string> ();
+  NS_ABORT_MSG_IF (!size, "aggregation needs a window");
+  window.size = Time (*size);
+  window.slide = Time (aggregation["slide"].value_or (*size));
+
+  window.quantiles.clear ();
+  if (const toml::array *quantiles = aggregation["quantiles"].as_array ())
+    {
+      for (const toml::node &quantile : *quantiles)
+        {
+          optional<double> rank = quantile.value<double> ();
+          NS_ABORT_MSG_IF (!rank, "aggregation quantiles are not numbers");
+          window.quantiles.push_back (*rank);
+        }
+    }
+  else
+    window.quantiles = {0.5, 0.9, 0.99};
+
+  return true;
+}
+
 void
-parseEcofenConfigs (toml::table ecofenConfigs, string outPath)
+parseEcofenConfigs (const toml::table &ecofenConfigs, string outPath)
 {
   ConsumptionLogger consoLogger;
   TimeValue stopTime;
@@ -46,12 +79,19 @@ parseEcofenConfigs (toml::table ecofenConfigs, string outPath)
   consoLogger.NodeConsoAll (Time (ecofenConfigs["interval"].value_or ("5s")), stopTime.Get ());
 
   if (ecofenConfigs["logFile"].value_or (false))
-    consoLogger.NodeConsoAllLog (Time (ecofenConfigs["logInterval"].value_or ("5s")),
-                                 stopTime.Get (), SystemPath::Append (outPath, "ecofen-trace.csv"));
+    {
+      consoLogger.NodeConsoAllLog (Time (ecofenConfigs["logInterval"].value_or ("5s")),
+                                   stopTime.Get (), SystemPath::Append (outPath, "ecofen-trace"),
+                                   ecofenConfigs["logFormat"].value_or ("csv"));
+
+      TraceWindow window;
+      if (parseTraceWindow (ecofenConfigs, window))
+        consoLogger.SetWindow (window);
+    }
 }
 
 void
-parseSwitchStatsConfigs (toml::table switchConfigs, string outPath)
+parseSwitchStatsConfigs (const toml::table &switchConfigs, string outPath)
 {
   if (switchConfigs["enable"].value_or (false))
     {
@@ -61,13 +101,18 @@ parseSwitchStatsConfigs (toml::table switchConfigs, string outPath)
       SwitchStatsHelper statsHelper;
       statsHelper.InstallAll ();
 
-      SwitchStatsLogger statsLogger (SystemPath::Append (outPath, "switch-stats.csv"));
+      SwitchStatsLogger statsLogger (SystemPath::Append (outPath, "switch-stats"),
+                                     switchConfigs["logFormat"].value_or ("csv"));
       statsLogger.LogStatsAll (Time (switchConfigs["interval"].value_or ("5s")), stopTime.Get ());
+
+      TraceWindow window;
+      if (parseTraceWindow (switchConfigs, window))
+        statsLogger.SetWindow (window);
     }
 }
 
 void
-parseLinkStatsConfigs (toml::table linkConfigs, string outPath)
+parseLinkStatsConfigs (const toml::table &linkConfigs, string outPath)
 {
   LinkStatsHelper statsHelper;
   statsHelper.InstallAll ();
@@ -79,34 +124,28 @@ parseLinkStatsConfigs (toml::table linkConfigs, string outPath)
   statsLogger.ComputeStatsAll (Time (linkConfigs["interval"].value_or ("5s")), stopTime.Get ());
 
   if (linkConfigs["logFile"].value_or (false))
-    statsLogger.ComputeStatsAllLog (Time (linkConfigs["logInterval"].value_or ("5s")),
-                                    stopTime.Get (),
-                                    SystemPath::Append (outPath, "link-stats.csv"));
+    {
+      statsLogger.ComputeStatsAllLog (Time (linkConfigs["logInterval"].value_or ("5s")),
+                                      stopTime.Get (), SystemPath::Append (outPath, "link-stats"),
+                                      linkConfigs["logFormat"].value_or ("csv"));
+
+      TraceWindow window;
+      if (parseTraceWindow (linkConfigs, window))
+        statsLogger.SetWindow (window);
+    }
 }
 
 void
-parseFlowMonitorConfigs (toml::table flowMonitorConfigs)
+parseFlowMonitorConfigs (const toml::table &flowMonitorConfigs)
 {
   GlobalValue::Bind ("FlowMonitorEnabled",
                      BooleanValue (flowMonitorConfigs["enable"].value_or (false)));
 }
 
 void
-parseConfigs (std::string topoName, std::string outPath)
+parseConfigs (const TopologySpec &spec, std::string outPath)
 {
-  string configsFile = SystemPath::Append (topoName, "configs.toml");
-
-  NS_ABORT_MSG_IF (!SystemPath::Exists (configsFile), "applications.toml not found");
-
-  toml::table tbl;
-  try
-    {
-      tbl = toml::parse_file (configsFile);
-    }
-  catch (const toml::parse_error &err)
-    {
-      NS_ABORT_MSG ("Error parsing configs.toml" << err.description ());
-    }
+  const toml::table &tbl = spec.configsTable;
 
   parseSimConfigs (*tbl["simulator"].as_table ());
   parseEcofenConfigs (*tbl["ecofen"].as_table (), outPath);
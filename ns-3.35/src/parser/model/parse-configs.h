@@ -24,10 +24,11 @@
 #define PARSE_CONFIGS_H
 
 #include "ns3/core-module.h"
+#include "parse-spec.h"
 
 namespace ns3 {
 
-void parseConfigs (std::string topoName, std::string outPath);
+void parseConfigs (const TopologySpec &spec, std::string outPath);
 
 } // namespace ns3
 
@@ -30,13 +30,35 @@ namespace ns3 {
 using namespace std;
 using json = nlohmann::json;
 
+/**
+ * A series is either an array of values, one per minute wrapping around, or
+ * an object giving its values and format, e.g.
+ * {"start": "0s", "step": "15min", "boundary": "hold", "interpolation": "linear", "values": [...]}
+ */
+static TimeSeries
+parseSeries (const json &series, vector<float> &values)
+{
+  if (series.is_array ())
+    {
+      values = series.get<vector<float>> ();
+      return TimeSeries ();
+    }
+
+  values = series.at ("values").get<vector<float>> ();
+  return TimeSeries (Time (series.value ("start", "0s")), Time (series.value ("step", "1min")),
+                     TimeSeries::ParseBoundary (series.value ("boundary", "wrap")),
+                     TimeSeries::ParseInterpolation (series.value ("interpolation", "step")));
+}
+
 void
 parseEnergy (std::string topoName, std::string estiFile, std::string flexFile)
 {
   string flexFilePath = SystemPath::Append (topoName, flexFile);
   string estiFilePath = SystemPath::Append (topoName, estiFile);
 
-  if (SystemPath::Exists (flexFilePath))
+  if (SystemPath::Exists (flexFilePath) && SeriesFile::Probe (flexFilePath))
+    EnergyAPI::LoadFlexFile (flexFilePath);
+  else if (SystemPath::Exists (flexFilePath))
     {
       try
         {
@@ -44,9 +66,13 @@ parseEnergy (std::string topoName, std::string estiFile, std::string flexFile)
           json flex = json::parse (flexFile);
 
           for (const auto &pair : flex.items ())
-            EnergyAPI::AddFlexArray (pair.key (), pair.value ());
+            {
+              vector<float> values;
+              TimeSeries format = parseSeries (pair.value (), values);
+              EnergyAPI::AddFlexArray (pair.key (), values, format);
+            }
         }
-      catch (const json::parse_error &err)
+      catch (const json::exception &err)
         {
           NS_ABORT_MSG ("Failed to parse " << flexFilePath);
         }
@@ -54,7 +80,9 @@ parseEnergy (std::string topoName, std::string estiFile, std::string flexFile)
   else
     std::cout << flexFilePath << " not found. Skipping flexibility values." << std::endl;
 
-  if (SystemPath::Exists (estiFilePath))
+  if (SystemPath::Exists (estiFilePath) && SeriesFile::Probe (estiFilePath))
+    EnergyAPI::LoadEstimateFile (estiFilePath);
+  else if (SystemPath::Exists (estiFilePath))
     {
       try
         {
@@ -62,9 +90,13 @@ parseEnergy (std::string topoName, std::string estiFile, std::string flexFile)
           json esti = json::parse (estiFile);
 
           for (const auto &pair : esti.items ())
-            EnergyAPI::AddEstimateArray (pair.key (), pair.value ());
+            {
+              vector<float> values;
+              TimeSeries format = parseSeries (pair.value (), values);
+              EnergyAPI::AddEstimateArray (pair.key (), values, format);
+            }
         }
-      catch (const json::parse_error &err)
+      catch (const json::exception &err)
         {
           NS_ABORT_MSG ("Failed to parse " << estiFilePath);
         }
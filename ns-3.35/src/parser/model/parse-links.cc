@@ -28,25 +28,121 @@
 #include "ns3/ofswitch13-module.h"
 #include "ns3/topology-module.h"
 #include "ns3/tap-bridge-module.h"
+#include "ns3/alr-link.h"
+#include "ns3/lpi-link.h"
+#include "ns3/data-rate-netdevice-energy-helper.h"
 #include "parser.h"
+#include "address-planner.h"
 
 namespace ns3 {
 
 using namespace std;
 
+/**
+ * Abort unless the interface models of both ends have a consumption for every
+ * rate of the link, the energy models are only installed once the links are.
+ */
+static void
+checkInterfaceRates (NetDeviceContainer devices, const vector<DataRate> &rates)
+{
+  for (uint32_t i = 0; i < devices.GetN (); i++)
+    {
+      Ptr<Node> node = devices.Get (i)->GetNode ();
+      auto it = Parser::m_interfaceEnergyModels.find (node);
+      if (it == Parser::m_interfaceEnergyModels.end ())
+        continue;
+
+      Ptr<DataRateNetdeviceEnergyHelper> model =
+          DynamicCast<DataRateNetdeviceEnergyHelper> (it->second);
+      if (!model)
+        continue;
+
+      for (const DataRate &rate : rates)
+        NS_ABORT_MSG_IF (!model->HasDataRate (rate.GetBitRate ()),
+                         "ALR rate " << rate << " has no consumption in the interface model of "
+                                     << Names::FindName (node));
+    }
+}
+
+void
+installAlr (const toml::table &configs, NetDeviceContainer devices)
+{
+  Ptr<AlrLink> alr = CreateObject<AlrLink> ();
+  alr->SetAttribute ("SwitchTime", TimeValue (Time (configs["switchTime"].value_or ("1ms"))));
+  alr->SetAttribute ("SwitchEnergy", DoubleValue (configs["switchEnergy"].value_or (0.0)));
+  alr->SetAttribute ("HighThreshold", UintegerValue (configs["highThreshold"].value_or (10)));
+  alr->SetLink (devices);
+
+  vector<DataRate> rates;
+  if (const toml::array *dataRates = configs.get_as<toml::array> ("rates"))
+    for (size_t i = 0; i < dataRates->size (); i++)
+      rates.push_back (DataRate (dataRates->at (i).ref<string> ()));
+  alr->DeclareRates (rates);
+
+  rates.push_back (DynamicCast<PointToPointEthernetNetDevice> (devices.Get (0))->GetDataRate ());
+  checkInterfaceRates (devices, rates);
+
+  devices.Get (0)->GetChannel ()->AggregateObject (alr);
+}
+
 void
-installLinks (toml::table tbl, string outPath)
+installLpi (const toml::table &configs, NetDeviceContainer devices)
 {
-  Ipv4AddressHelper address;
-  address.SetBase ("10.1.1.0", "255.255.255.0");
+  Ptr<LpiLink> lpi = CreateObject<LpiLink> ();
+  lpi->SetAttribute ("IdleTime", TimeValue (Time (configs["idleTime"].value_or ("0s"))));
+  lpi->SetAttribute ("SleepTime", TimeValue (Time (configs["sleepTime"].value_or ("182us"))));
+  lpi->SetAttribute ("WakeUpTime", TimeValue (Time (configs["wakeUpTime"].value_or ("16.5us"))));
+  lpi->SetAttribute ("RefreshTime", TimeValue (Time (configs["refreshTime"].value_or ("198us"))));
+  lpi->SetAttribute ("QuietTime", TimeValue (Time (configs["quietTime"].value_or ("20ms"))));
+  lpi->SetAttribute ("SleepEnergy", DoubleValue (configs["sleepEnergy"].value_or (0.0)));
+  lpi->SetAttribute ("WakeUpEnergy", DoubleValue (configs["wakeUpEnergy"].value_or (0.0)));
+  lpi->SetAttribute ("RefreshEnergy", DoubleValue (configs["refreshEnergy"].value_or (0.0)));
 
-  for (auto pair : tbl)
+  // States 0 to 2 are off, on and switching
+  int64_t lpiState = configs["lpiState"].value_or (3);
+  NS_ABORT_MSG_IF (lpiState < 3, "LPI state " << lpiState << " is reserved");
+  lpi->SetAttribute ("LpiState", UintegerValue (lpiState));
+  lpi->SetLink (devices);
+
+  devices.Get (0)->GetChannel ()->AggregateObject (lpi);
+}
+
+void
+installOpenFlowPcap (const toml::table &configs, Ptr<OFSwitch13Helper> of13Helper, string outPath)
+{
+  NodeContainer switches;
+  if (const toml::array *names = configs.get_as<toml::array> ("switches"))
+    for (size_t i = 0; i < names->size (); i++)
+      {
+        string name = names->at (i).value_or (string ());
+        Ptr<Node> sw = Names::Find<Node> (name);
+        NS_ABORT_MSG_IF (!sw || !sw->IsSwitch (), "Unknown " << name << " switch to capture");
+        switches.Add (sw);
+      }
+  else
+    switches = NodeContainer::GetGlobalSwitches ();
+
+  QueueSize ringSize (configs["ringSize"].value_or ("0B"));
+  NS_ABORT_MSG_IF (ringSize.GetUnit () != QueueSizeUnit::BYTES,
+                   "OpenFlow pcap ringSize must be in bytes");
+
+  of13Helper->EnableOpenFlowPcap (SystemPath::Append (outPath, "ofchannel"), switches,
+                                  configs["snapLen"].value_or (0), ringSize.GetValue ());
+}
+
+void
+installLinks (const TopologySpec &spec, const NodeContainer &nodes, string outPath)
+{
+  // Without an addressing section every host shares 10.1.1.0/24
+  toml::node_view<const toml::node> addressing = spec.configsTable["addressing"];
+  AddressPlanner planner (addressing["supernet"].value_or ("10.1.1.0/24"),
+                          addressing["prefixLength"].value_or (24));
+
+  for (const LinkSpec &link : spec.links)
     {
-      toml::table configs = *pair.second.as_table ();
-      string node0 = configs["edges"][0].ref<string> ();
-      string node1 = configs["edges"][1].ref<string> ();
-      Ptr<Node> n0 = Names::Find<Node> (node0);
-      Ptr<Node> n1 = Names::Find<Node> (node1);
+      const toml::table &configs = *link.configs;
+      Ptr<Node> n0 = nodes.Get (link.edges[0]);
+      Ptr<Node> n1 = nodes.Get (link.edges[1]);
 
       PointToPointEthernetHelper p2pHelper;
       p2pHelper.SetChannelAttribute ("Delay", StringValue (configs["delay"].value_or ("1ns")));
@@ -55,34 +151,36 @@ installLinks (toml::table tbl, string outPath)
 
       NetDeviceContainer p2pDevices = p2pHelper.Install (NodeContainer (n0, n1));
       Ptr<Channel> channel = p2pDevices.Get (0)->GetChannel ();
-      Names::Add (pair.first.data (), channel);
+      Names::Add (string (link.name), channel);
 
       if (configs["pcap"].value_or (false))
         p2pHelper.EnablePcap (SystemPath::Append (outPath, "capture"), p2pDevices, true);
 
+      if (const toml::table *alr = configs.get_as<toml::table> ("alr"))
+        installAlr (*alr, p2pDevices);
+
+      if (const toml::table *lpi = configs.get_as<toml::table> ("lpi"))
+        installLpi (*lpi, p2pDevices);
+
       if (n0->IsHost ())
-        {
-          Ipv4InterfaceContainer ips = address.Assign (p2pDevices.Get (0));
-          Topology::AddHost (n0, ips.GetAddress (0));
-        }
+        Topology::AddHost (n0, planner.Assign (p2pDevices.Get (0), n1));
 
       if (n1->IsHost ())
-        {
-          Ipv4InterfaceContainer ips = address.Assign (p2pDevices.Get (1));
-          Topology::AddHost (n1, ips.GetAddress (0));
-        }
+        Topology::AddHost (n1, planner.Assign (p2pDevices.Get (1), n0));
 
       Topology::AddLink (n0, n1, channel);
     }
 }
 
 void
-installController (std::string outPath)
+installController (const TopologySpec &spec, std::string outPath)
 {
   // Create controller node
   Ptr<Node> controllerNode = CreateObject<Node> ();
   Names::Add ("controller", controllerNode);
   Ptr<OFSwitch13Helper> of13Helper;
+  Ptr<OFSwitch13Controller> controller;
+  toml::node_view<const toml::node> configs = spec.configsTable["controller"];
 
   // Create controller
   StringValue controllerType;
@@ -104,9 +202,36 @@ installController (std::string outPath)
     {
       ObjectFactory factory;
       of13Helper = CreateObject<OFSwitch13InternalHelper> ();
-      of13Helper->SetChannelType (OFSwitch13Helper::DEDICATEDP2PETHERNET);
       factory.SetTypeId (controllerType.Get ());
-      Ptr<OFSwitch13Controller> controller = factory.Create<OFSwitch13Controller> ();
+
+      string_view channel = configs["channel"].value_or (string_view ("p2p"));
+      if (channel == "direct")
+        {
+          of13Helper->SetChannelType (OFSwitch13Helper::DIRECT);
+          of13Helper->SetAttribute (
+              "ChannelLatency", TimeValue (Time (configs["channelLatency"].value_or ("0s"))));
+        }
+      else if (channel == "p2p")
+        of13Helper->SetChannelType (OFSwitch13Helper::DEDICATEDP2PETHERNET);
+      else
+        NS_ABORT_MSG ("Unknown " << channel << " OpenFlow channel");
+
+      string_view routing = configs["routing"].value_or (string_view ());
+      if (!routing.empty ())
+        factory.Set ("Routing", StringValue (string (routing)));
+      string_view multipath = configs["multipath"].value_or (string_view ());
+      if (!multipath.empty ())
+        factory.Set ("Multipath", StringValue (string (multipath)));
+      string_view aggregation = configs["routeAggregation"].value_or (string_view ());
+      if (!aggregation.empty ())
+        factory.Set ("RouteAggregation", StringValue (string (aggregation)));
+      if (std::optional<bool> fastFailover = configs["fastFailover"].value<bool> ())
+        factory.Set ("FastFailover", BooleanValue (*fastFailover));
+      string_view rerouteDelay = configs["rerouteDelay"].value_or (string_view ());
+      if (!rerouteDelay.empty ())
+        factory.Set ("RerouteDelay", TimeValue (Time (string (rerouteDelay))));
+
+      controller = factory.Create<OFSwitch13Controller> ();
       DynamicCast<OFSwitch13InternalHelper> (of13Helper)
           ->InstallController (controllerNode, controller);
     }
@@ -124,7 +249,24 @@ installController (std::string outPath)
       of13Helper->SetDeviceAttribute ("CpuCapacity", StringValue ("100Gbps"));
     }
   of13Helper->CreateOpenFlowChannels ();
-  of13Helper->EnableOpenFlowPcap (SystemPath::Append (outPath, "ofchannel"));
+
+  // Every channel is captured, unless disabled or bounded
+  if (const toml::table *pcap = configs["pcap"].as_table ())
+    installOpenFlowPcap (*pcap, of13Helper, outPath);
+  else if (configs["pcap"].value_or (true))
+    of13Helper->EnableOpenFlowPcap (SystemPath::Append (outPath, "ofchannel"), switches, 0, 0);
+
+  // Preinstalled switches forward from the start, without waiting for the handshake
+  string_view bootstrap = configs["bootstrap"].value_or (string_view ("handshake"));
+  if (bootstrap == "preinstalled")
+    {
+      Ptr<SimpleController> simpleController = DynamicCast<SimpleController> (controller);
+      NS_ABORT_MSG_IF (!simpleController,
+                       controllerType.Get () << " controller cannot preinstall the routes");
+      simpleController->Preinstall ();
+    }
+  else if (bootstrap != "handshake")
+    NS_ABORT_MSG ("Unknown " << bootstrap << " bootstrap");
 }
 
 void
@@ -170,24 +312,11 @@ parseLinkFailures (string topoName, string linkFailuresFile)
 }
 
 void
-parseLinks (string topoName, string outPath, string linkFailuresFile)
+parseLinks (const TopologySpec &spec, const NodeContainer &nodes, string topoName, string outPath,
+            string linkFailuresFile)
 {
-  string linksFile = SystemPath::Append (topoName, "links.toml");
-
-  NS_ABORT_MSG_IF (!SystemPath::Exists (linksFile), "links.toml not found");
-
-  toml::table tbl;
-  try
-    {
-      tbl = toml::parse_file (linksFile);
-    }
-  catch (const toml::parse_error &err)
-    {
-      NS_ABORT_MSG ("Error parsing links.toml" << err.description ());
-    }
-
-  installLinks (tbl, outPath);
-  installController (outPath);
+  installLinks (spec, nodes, outPath);
+  installController (spec, outPath);
   parseLinkFailures (topoName, linkFailuresFile);
 
   for (auto pair : Parser::m_interfaceEnergyModels)
@@ -24,10 +24,17 @@
 #define PARSE_LINKS_H
 
 #include "ns3/core-module.h"
+#include "ns3/node-container.h"
+#include "parse-spec.h"
 
 namespace ns3 {
 
-void parseLinks (std::string topoName, std::string outPath, std::string linkFailuresFile);
+/**
+ * Create the links of a spec between its nodes, as returned by parseNodes,
+ * then the controller.
+ */
+void parseLinks (const TopologySpec &spec, const NodeContainer &nodes, std::string topoName,
+                 std::string outPath, std::string linkFailuresFile);
 
 } // namespace ns3
 
@@ -27,6 +27,7 @@
 #include "ns3/node.h"
 #include "ns3/ecofen-module.h"
 #include "ns3/topology-module.h"
+#include "ns3/energy-api.h"
 #include "parse-templates.h"
 
 namespace ns3 {
@@ -34,83 +35,68 @@ namespace ns3 {
 using namespace std;
 
 void
-parseEnergyModels (toml::table configs, Ptr<Node> sw)
+parseEnergyModels (const toml::table &configs, Ptr<Node> sw)
 {
-  if (!configs.contains ("chassis"))
+  const toml::table *chassis = configs.get_as<toml::table> ("chassis");
+  if (!chassis)
     return;
 
   // Parse chassis model
-  toml::table chassis = *configs["chassis"].as_table ();
   Ptr<NodeEnergyHelper> model = NULL;
 
-  if (chassis.contains ("template"))
-    model = Parser::m_chassisTemplates[chassis["template"].ref<std::string> ()];
+  if (chassis->contains ("template"))
+    model = Parser::m_chassisTemplates[(*chassis)["template"].ref<std::string> ()];
   else
-    model = parseChassisEnergyModel (chassis);
+    model = parseChassisEnergyModel (*chassis);
 
   model->Install (sw);
 
-  if (!configs.contains ("interfaces"))
+  const toml::table *interfaces = configs.get_as<toml::table> ("interfaces");
+  if (!interfaces)
     return;
 
   // Parse interface model
-  toml::table interfaces = *configs["interfaces"].as_table ();
   Ptr<NetdeviceEnergyHelper> interfaceModel = NULL;
 
-  if (interfaces.contains ("template"))
-    interfaceModel = Parser::m_interfaceTemplates[interfaces["template"].ref<std::string> ()];
+  if (interfaces->contains ("template"))
+    interfaceModel = Parser::m_interfaceTemplates[(*interfaces)["template"].ref<std::string> ()];
   else
-    interfaceModel = parseInterfaceEnergyModel (interfaces);
+    interfaceModel = parseInterfaceEnergyModel (*interfaces);
 
   Parser::m_interfaceEnergyModels[sw] = interfaceModel;
 }
 
-void
-parseNodes (string topoName)
+NodeContainer
+parseNodes (const TopologySpec &spec)
 {
-  string nodesFile = SystemPath::Append (topoName, "nodes.toml");
-
-  NS_ABORT_MSG_IF (!SystemPath::Exists (nodesFile), "nodes.toml not found");
-
-  toml::table tbl;
-  try
-    {
-      tbl = toml::parse_file (nodesFile);
-    }
-  catch (const toml::parse_error &err)
-    {
-      NS_ABORT_MSG ("Error parsing nodes.toml" << err.description ());
-    }
-
+  NodeContainer nodes;
   InternetStackHelper stackHelper;
-  for (auto pair : tbl)
+  for (const NodeSpec &nodeSpec : spec.nodes)
     {
-      string nodeName = pair.first.data ();
-      toml::table configs = *pair.second.as_table ();
+      string nodeName (nodeSpec.name);
+      const toml::table &configs = *nodeSpec.configs;
 
       Ptr<Node> node = CreateObject<Node> ();
       Names::Add (nodeName, node);
+      nodes.Add (node);
 
-      string nodeType = configs["type"].value_or ("switch");
-
-      if (!nodeType.compare ("switch"))
+      if (!nodeSpec.host)
         {
           node->SetAttribute ("NodeType", StringValue ("Switch"));
           node->SetAttribute ("CpuCapacity",
                               StringValue (configs["cpuCapacity"].value_or ("100Gbps")));
           parseEnergyModels (configs, node);
+          EnergyAPI::SetNodeRegion (node->GetId (), configs["energyRegion"].value_or (nodeName));
           Topology::AddSwitch (node);
         }
-      else if (!nodeType.compare ("host"))
+      else
         {
           node->SetAttribute ("NodeType", StringValue ("Host"));
           stackHelper.Install (node);
         }
-      else
-        {
-          NS_ABORT_MSG ("Unknown " << nodeType << " node type");
-        }
     }
+
+  return nodes;
 }
 
 } // namespace ns3
@@ -24,10 +24,17 @@
 #define PARSE_NODES_H
 
 #include "ns3/core-module.h"
+#include "ns3/node-container.h"
+#include "parse-spec.h"
 
 namespace ns3 {
 
-void parseNodes (std::string topoName);
+/**
+ * Create the nodes of a spec, in its order.
+ *
+ * \returns The nodes, indexed as TopologySpec::nodes.
+ */
+NodeContainer parseNodes (const TopologySpec &spec);
 
 } // namespace ns3
 
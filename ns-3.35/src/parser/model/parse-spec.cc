@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "parse-spec.h"
+#include <thread>
+
+namespace ns3 {
+
+using namespace std;
+
+#define TEMPLATES_FILE_DEFAULT "../topologies/energy-templates.toml"
+
+// Entries validated by each thread, at least
+static const size_t MIN_SHARD_SIZE = 1024;
+
+/**
+ * Call f (i) for i in [0, n), split in contiguous shards across threads.
+ */
+template <typename F>
+static void
+parallelFor (size_t n, F f)
+{
+  size_t nShards = min<size_t> (thread::hardware_concurrency (), n / MIN_SHARD_SIZE);
+  nShards = max<size_t> (nShards, 1);
+
+  vector<thread> threads;
+  for (size_t s = 1; s < nShards; s++)
+    threads.emplace_back ([=] () {
+      for (size_t i = n * s / nShards; i < n * (s + 1) / nShards; i++)
+        f (i);
+    });
+
+  for (size_t i = 0; i < n / nShards; i++)
+    f (i);
+
+  for (thread &t : threads)
+    t.join ();
+}
+
+static void
+parseFile (string topoName, string fileName, toml::table &tbl)
+{
+  try
+    {
+      tbl = toml::parse_file (SystemPath::Append (topoName, fileName));
+    }
+  catch (const toml::parse_error &err)
+    {
+      NS_ABORT_MSG ("Error parsing " << fileName << err.description ());
+    }
+}
+
+static void
+parseTemplatesFile (string templatesFile, toml::table &tbl, bool &found)
+{
+  try
+    {
+      tbl = toml::parse_file (templatesFile);
+      found = true;
+    }
+  catch (const toml::parse_error &err)
+    {
+      found = false;
+    }
+}
+
+static uint32_t
+findNode (const TopologySpec &spec, toml::node_view<const toml::node> name, string_view entry)
+{
+  optional<string_view> node = name.value<string_view> ();
+  NS_ABORT_MSG_IF (!node, entry << ": missing node");
+
+  auto it = spec.nodeIndex.find (*node);
+  NS_ABORT_MSG_IF (it == spec.nodeIndex.end (), entry << ": unknown node " << *node);
+  return it->second;
+}
+
+static void
+parseNodesSpec (string topoName, TopologySpec &spec)
+{
+  parseFile (topoName, "nodes.toml", spec.nodesTable);
+
+  spec.nodes.reserve (spec.nodesTable.size ());
+  for (auto &&[key, value] : spec.nodesTable)
+    {
+      NS_ABORT_MSG_IF (!value.is_table (), "Node " << key.str () << " is not a table");
+      spec.nodeIndex[key.str ()] = spec.nodes.size ();
+      spec.nodes.push_back ({key.str (), value.as_table (), false});
+    }
+
+  parallelFor (spec.nodes.size (), [&spec] (size_t i) {
+    NodeSpec &node = spec.nodes[i];
+    string_view nodeType = (*node.configs)["type"].value_or (string_view ("switch"));
+
+    NS_ABORT_MSG_IF (nodeType != "switch" && nodeType != "host",
+                     "Unknown " << nodeType << " node type");
+    node.host = nodeType == "host";
+  });
+}
+
+static void
+parseLinksSpec (TopologySpec &spec)
+{
+  spec.links.reserve (spec.linksTable.size ());
+  for (auto &&[key, value] : spec.linksTable)
+    {
+      NS_ABORT_MSG_IF (!value.is_table (), "Link " << key.str () << " is not a table");
+      spec.links.push_back ({key.str (), value.as_table (), {0, 0}});
+    }
+
+  parallelFor (spec.links.size (), [&spec] (size_t i) {
+    LinkSpec &link = spec.links[i];
+    const toml::array *edges = link.configs->get_as<toml::array> ("edges");
+
+    NS_ABORT_MSG_IF (!edges || edges->size () != 2, "Link " << link.name << " needs two edges");
+    link.edges[0] = findNode (spec, toml::node_view<const toml::node> (edges->get (0)), link.name);
+    link.edges[1] = findNode (spec, toml::node_view<const toml::node> (edges->get (1)), link.name);
+  });
+}
+
+static void
+parseAppsSpec (TopologySpec &spec)
+{
+  spec.apps.reserve (spec.appsTable.size ());
+  for (auto &&[key, value] : spec.appsTable)
+    {
+      NS_ABORT_MSG_IF (!value.is_table (), "Application " << key.str () << " is not a table");
+      spec.apps.push_back ({key.str (), value.as_table (), "", 0, 0});
+    }
+
+  parallelFor (spec.apps.size (), [&spec] (size_t i) {
+    AppSpec &app = spec.apps[i];
+    const toml::table &configs = *app.configs;
+
+    app.type = configs["type"].value_or (string_view ());
+    NS_ABORT_MSG_IF (app.type != "v4ping" && app.type != "bulkSend" && app.type != "constSend" &&
+                         app.type != "sinSend" && app.type != "PPBP",
+                     "Unknown " << app.type << " application");
+
+    app.host = findNode (spec, configs["host"], app.name);
+    app.remote = findNode (spec, configs["remote"], app.name);
+  });
+}
+
+void
+parseSpec (std::string topoName, TopologySpec &spec)
+{
+  NS_ABORT_MSG_IF (!SystemPath::Exists (SystemPath::Append (topoName, "nodes.toml")),
+                   "nodes.toml not found");
+  NS_ABORT_MSG_IF (!SystemPath::Exists (SystemPath::Append (topoName, "links.toml")),
+                   "links.toml not found");
+  NS_ABORT_MSG_IF (!SystemPath::Exists (SystemPath::Append (topoName, "applications.toml")),
+                   "applications.toml not found");
+  NS_ABORT_MSG_IF (!SystemPath::Exists (SystemPath::Append (topoName, "configs.toml")),
+                   "configs.toml not found");
+
+  // Links and applications refer to nodes, they are validated once the nodes are known
+  thread links (parseFile, topoName, "links.toml", ref (spec.linksTable));
+  thread apps (parseFile, topoName, "applications.toml", ref (spec.appsTable));
+  thread configs ([&spec, topoName] () {
+    parseFile (topoName, "configs.toml", spec.configsTable);
+    parseTemplatesFile (TEMPLATES_FILE_DEFAULT, spec.defaultTemplatesTable,
+                        spec.hasDefaultTemplates);
+    parseTemplatesFile (SystemPath::Append (topoName, "energy-templates.toml"),
+                        spec.templatesTable, spec.hasTemplates);
+  });
+  parseNodesSpec (topoName, spec);
+  links.join ();
+  apps.join ();
+  configs.join ();
+
+  thread appsSpec (parseAppsSpec, ref (spec));
+  parseLinksSpec (spec);
+  appsSpec.join ();
+}
+
+std::vector<std::string>
+getSpecInputs (std::string topoName)
+{
+  return {SystemPath::Append (topoName, "nodes.toml"),
+          SystemPath::Append (topoName, "links.toml"),
+          SystemPath::Append (topoName, "applications.toml"),
+          SystemPath::Append (topoName, "configs.toml"),
+          TEMPLATES_FILE_DEFAULT,
+          SystemPath::Append (topoName, "energy-templates.toml")};
+}
+
+} // namespace ns3
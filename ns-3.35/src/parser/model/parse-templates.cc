@@ -27,13 +27,11 @@ namespace ns3 {
 
 using namespace std;
 
-#define TEMPLATES_FILE_DEFAULT "../topologies/energy-templates.toml"
-
 Ptr<NodeEnergyHelper>
-parseLoadBasedModel (toml::table chassis, Ptr<CpuLoadBasedEnergyHelper> helper)
+parseLoadBasedModel (const toml::table &chassis, Ptr<CpuLoadBasedEnergyHelper> helper)
 {
-  toml::array &percentages = *chassis.get_as<toml::array> ("percentages");
-  toml::array &consumptions = *chassis.get_as<toml::array> ("consumptions");
+  const toml::array &percentages = *chassis.get_as<toml::array> ("percentages");
+  const toml::array &consumptions = *chassis.get_as<toml::array> ("consumptions");
   map<double, double> values = map<double, double> ();
 
   for (size_t i = 0; i < percentages.size (); i++)
@@ -44,7 +42,7 @@ parseLoadBasedModel (toml::table chassis, Ptr<CpuLoadBasedEnergyHelper> helper)
 }
 
 Ptr<NodeEnergyHelper>
-parseChassisEnergyModel (toml::table chassis)
+parseChassisEnergyModel (const toml::table &chassis)
 {
   string chassisModel = chassis["model"].ref<string> ();
 
@@ -71,8 +69,8 @@ parseChassisEnergyModel (toml::table chassis)
       Ptr<EnabledPortsEnergyHelper> helper = CreateObject<EnabledPortsEnergyHelper> ();
       helper->SetIdleConsumption (chassis["idleConso"].value_or (0.0));
 
-      toml::array &dataRates = *chassis.get_as<toml::array> ("dataRates");
-      toml::array &consumptions = *chassis.get_as<toml::array> ("consumptions");
+      const toml::array &dataRates = *chassis.get_as<toml::array> ("dataRates");
+      const toml::array &consumptions = *chassis.get_as<toml::array> ("consumptions");
       map<uint64_t, double> values = map<uint64_t, double> ();
 
       for (size_t i = 0; i < dataRates.size (); i++)
@@ -89,7 +87,7 @@ parseChassisEnergyModel (toml::table chassis)
 }
 
 Ptr<NetdeviceEnergyHelper>
-parseInterfaceEnergyModel (toml::table interface)
+parseInterfaceEnergyModel (const toml::table &interface)
 {
   string interfaceModel = interface["model"].ref<string> ();
 
@@ -98,8 +96,8 @@ parseInterfaceEnergyModel (toml::table interface)
       Ptr<DataRateNetdeviceEnergyHelper> helper = CreateObject<DataRateNetdeviceEnergyHelper> ();
       helper->SetUnit (DataRate (interface["unit"].ref<string> ()).GetBitRate ());
 
-      toml::array &dataRates = *interface.get_as<toml::array> ("dataRates");
-      toml::array &consumptions = *interface.get_as<toml::array> ("consumptions");
+      const toml::array &dataRates = *interface.get_as<toml::array> ("dataRates");
+      const toml::array &consumptions = *interface.get_as<toml::array> ("consumptions");
       map<uint64_t, double> values = map<uint64_t, double> ();
 
       for (size_t i = 0; i < dataRates.size (); i++)
@@ -107,6 +105,7 @@ parseInterfaceEnergyModel (toml::table interface)
             consumptions.at (i).ref<double> ();
 
       helper->SetConsumptionValues (values);
+      helper->SetLpiConsumption (interface["lpiConso"].value_or (0.0));
       return helper;
     }
   else
@@ -114,64 +113,47 @@ parseInterfaceEnergyModel (toml::table interface)
 }
 
 void
-parseChassisTemplates (toml::table tbl)
+parseChassisTemplates (const toml::table &tbl)
 {
-  if (tbl.contains ("chassis"))
+  if (const toml::table *chassis = tbl.get_as<toml::table> ("chassis"))
     {
-      toml::table chassis = *tbl["chassis"].as_table ();
-
-      for (auto pair : chassis)
-        {
-          toml::table configs = *pair.second.as_table ();
-          Parser::m_chassisTemplates[pair.first.data ()] = parseChassisEnergyModel (configs);
-        }
+      for (auto &&[name, configs] : *chassis)
+        Parser::m_chassisTemplates[string (name.str ())] =
+            parseChassisEnergyModel (*configs.as_table ());
     }
 }
 
 void
-parseInterfacesTemplates (toml::table tbl)
+parseInterfacesTemplates (const toml::table &tbl)
 {
-  if (tbl.contains ("interfaces"))
+  if (const toml::table *interfaces = tbl.get_as<toml::table> ("interfaces"))
     {
-      toml::table interfaces = *tbl["interfaces"].as_table ();
-
-      for (auto pair : interfaces)
-        {
-          toml::table configs = *pair.second.as_table ();
-          Parser::m_interfaceTemplates[pair.first.data ()] = parseInterfaceEnergyModel (configs);
-        }
+      for (auto &&[name, configs] : *interfaces)
+        Parser::m_interfaceTemplates[string (name.str ())] =
+            parseInterfaceEnergyModel (*configs.as_table ());
     }
 }
 
 void
-parseTemplates (std::string topoName)
+parseTemplates (const TopologySpec &spec)
 {
-
-  toml::table tbl;
-
   // Default templates
-  try
+  if (spec.hasDefaultTemplates)
     {
-      tbl = toml::parse_file (TEMPLATES_FILE_DEFAULT);
-      parseChassisTemplates (tbl);
-      parseInterfacesTemplates (tbl);
-    }
-  catch (const toml::parse_error &err)
-    {
-      cout << "Default templates file not found" << endl;
+      parseChassisTemplates (spec.defaultTemplatesTable);
+      parseInterfacesTemplates (spec.defaultTemplatesTable);
     }
+  else
+    cout << "Default templates file not found" << endl;
 
   // Topology templates
-  try
+  if (spec.hasTemplates)
     {
-      tbl = toml::parse_file (SystemPath::Append (topoName, "energy-templates.toml"));
-      parseChassisTemplates (tbl);
-      parseInterfacesTemplates (tbl);
-    }
-  catch (const toml::parse_error &err)
-    {
-      cout << "Topology templates file not found" << endl;
+      parseChassisTemplates (spec.templatesTable);
+      parseInterfacesTemplates (spec.templatesTable);
     }
+  else
+    cout << "Topology templates file not found" << endl;
 }
 
 } // namespace ns3
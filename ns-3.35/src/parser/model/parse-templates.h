@@ -26,13 +26,14 @@
 #include "ns3/core-module.h"
 #include "ns3/ecofen-module.h"
 #include "toml.hpp"
+#include "parse-spec.h"
 
 namespace ns3 {
 
-Ptr<NodeEnergyHelper> parseChassisEnergyModel (toml::table chassis);
-Ptr<NetdeviceEnergyHelper> parseInterfaceEnergyModel (toml::table interface);
+Ptr<NodeEnergyHelper> parseChassisEnergyModel (const toml::table &chassis);
+Ptr<NetdeviceEnergyHelper> parseInterfaceEnergyModel (const toml::table &interface);
 
-void parseTemplates (std::string topoName);
+void parseTemplates (const TopologySpec &spec);
 
 } // namespace ns3
 
@@ -27,11 +27,18 @@
 #include "parse-configs.h"
 #include "parse-energy.h"
 #include "parse-templates.h"
+#include "parse-spec.h"
+#include "spec-cache.h"
+#include <thread>
 
 namespace ns3 {
 
 using namespace std;
 
+static GlobalValue g_TopologyCache =
+    GlobalValue ("TopologyCache", "Cache the parsed topology in its output folder",
+                 BooleanValue (true), MakeBooleanChecker ());
+
 std::map<std::string, Ptr<NodeEnergyHelper>> Parser::m_chassisTemplates =
     std::map<std::string, Ptr<NodeEnergyHelper>> ();
 
@@ -41,6 +48,28 @@ std::map<std::string, Ptr<NetdeviceEnergyHelper>> Parser::m_interfaceTemplates =
 std::map<Ptr<Node>, Ptr<NetdeviceEnergyHelper>> Parser::m_interfaceEnergyModels =
     std::map<Ptr<Node>, Ptr<NetdeviceEnergyHelper>> ();
 
+/**
+ * Load the spec from the cache file if it matches the topology files,
+ * otherwise parse it and refresh the cache. An empty cache file disables the
+ * cache.
+ */
+static void
+loadSpec (string topoPath, string cacheFile, TopologySpec &spec)
+{
+  if (cacheFile.empty ())
+    {
+      parseSpec (topoPath, spec);
+      return;
+    }
+
+  uint64_t key = hashSpecInputs (topoPath);
+  if (!readSpecCache (cacheFile, key, spec))
+    {
+      parseSpec (topoPath, spec);
+      writeSpecCache (cacheFile, key, spec);
+    }
+}
+
 void
 Parser::ParseTopology (string topoName, string estiFile, string flexFile, string linkFailuresFile)
 {
@@ -49,12 +78,22 @@ Parser::ParseTopology (string topoName, string estiFile, string flexFile, string
 
   NS_ABORT_MSG_IF (!SystemPath::Exists (topoPath), "Topology " << topoName << " not found");
 
+  BooleanValue cache;
+  GlobalValue::GetValueByName ("TopologyCache", cache);
+  string cacheFile = cache.Get () ? SystemPath::Append (outPath, "topology.cache") : "";
+
+  // The topology files are parsed and validated aside, then instantiated in order
+  TopologySpec spec;
+  thread specParser (loadSpec, topoPath, cacheFile, ref (spec));
+
   parseEnergy (topoPath, estiFile, flexFile);
-  parseTemplates (topoPath);
-  parseNodes (topoPath);
-  parseLinks (topoPath, outPath, linkFailuresFile);
-  parseApps (topoPath);
-  parseConfigs (topoPath, outPath);
+  specParser.join ();
+
+  parseTemplates (spec);
+  NodeContainer nodes = parseNodes (spec);
+  parseLinks (spec, nodes, topoPath, outPath, linkFailuresFile);
+  parseApps (spec, nodes);
+  parseConfigs (spec, outPath);
 }
 
 } // namespace ns3
@@ -0,0 +1,411 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "spec-cache.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "unistd.h"
+
+namespace ns3 {
+
+using namespace std;
+
+NS_LOG_COMPONENT_DEFINE ("SpecCache");
+
+static const char SPEC_CACHE_MAGIC[8] = {'F', 'X', 'T', 'O', 'P', 'O', '\0', '\0'};
+static const uint32_t SPEC_CACHE_VERSION = 1;
+
+// Nesting allowed in a snapshot, deeper tables are rejected
+static const uint32_t MAX_DEPTH = 64;
+
+enum Tag : uint8_t { TABLE, ARRAY, STRING, INTEGER, FLOAT, BOOLEAN };
+
+static bool
+readFile (string path, string &content)
+{
+  ifstream file (path, ios::binary);
+  if (!file)
+    return false;
+
+  ostringstream os;
+  os << file.rdbuf ();
+  content = os.str ();
+  return true;
+}
+
+uint64_t
+hashSpecInputs (std::string topoName)
+{
+  // FNV-1a over the path, presence and content of every input
+  uint64_t hash = 0xcbf29ce484222325;
+  auto update = [&hash] (const string &bytes) {
+    for (unsigned char c : bytes)
+      hash = (hash ^ c) * 0x100000001b3;
+  };
+
+  for (const string &path : getSpecInputs (topoName))
+    {
+      string content;
+      bool found = readFile (path, content);
+      update (path);
+      update (found ? string (1, '\1') + to_string (content.size ()) : string (1, '\0'));
+      update (content);
+    }
+
+  return hash;
+}
+
+/*
+ * Writing
+ */
+
+template <typename T>
+static void
+put (string &out, T value)
+{
+  out.append (reinterpret_cast<const char *> (&value), sizeof (value));
+}
+
+static void
+putString (string &out, string_view str)
+{
+  put<uint32_t> (out, str.size ());
+  out.append (str.data (), str.size ());
+}
+
+static bool writeNode (string &out, const toml::node &node);
+
+static bool
+writeTable (string &out, const toml::table &tbl)
+{
+  put<uint32_t> (out, tbl.size ());
+  for (auto &&[key, value] : tbl)
+    {
+      putString (out, key.str ());
+      if (!writeNode (out, value))
+        return false;
+    }
+  return true;
+}
+
+static bool
+writeNode (string &out, const toml::node &node)
+{
+  switch (node.type ())
+    {
+    case toml::node_type::table:
+      put<uint8_t> (out, TABLE);
+      return writeTable (out, *node.as_table ());
+    case toml::node_type::array:
+      put<uint8_t> (out, ARRAY);
+      put<uint32_t> (out, node.as_array ()->size ());
+      for (const toml::node &element : *node.as_array ())
+        {
+          if (!writeNode (out, element))
+            return false;
+        }
+      return true;
+    case toml::node_type::string:
+      put<uint8_t> (out, STRING);
+      putString (out, node.as_string ()->get ());
+      return true;
+    case toml::node_type::integer:
+      put<uint8_t> (out, INTEGER);
+      put<int64_t> (out, node.as_integer ()->get ());
+      return true;
+    case toml::node_type::floating_point:
+      put<uint8_t> (out, FLOAT);
+      put<double> (out, node.as_floating_point ()->get ());
+      return true;
+    case toml::node_type::boolean:
+      put<uint8_t> (out, BOOLEAN);
+      put<uint8_t> (out, node.as_boolean ()->get ());
+      return true;
+    default:
+      // Dates and times are not used by topologies
+      return false;
+    }
+}
+
+void
+writeSpecCache (std::string path, uint64_t key, const TopologySpec &spec)
+{
+  string out;
+  out.append (SPEC_CACHE_MAGIC, sizeof (SPEC_CACHE_MAGIC));
+  put<uint32_t> (out, SPEC_CACHE_VERSION);
+  put<uint64_t> (out, key);
+
+  for (const toml::table *tbl :
+       {&spec.nodesTable, &spec.linksTable, &spec.appsTable, &spec.configsTable,
+        &spec.defaultTemplatesTable, &spec.templatesTable})
+    {
+      if (!writeTable (out, *tbl))
+        {
+          NS_LOG_WARN ("Topology holds values without a binary encoding, not cached");
+          return;
+        }
+    }
+  put<uint8_t> (out, spec.hasDefaultTemplates);
+  put<uint8_t> (out, spec.hasTemplates);
+
+  for (const NodeSpec &node : spec.nodes)
+    put<uint8_t> (out, node.host);
+  for (const LinkSpec &link : spec.links)
+    {
+      put<uint32_t> (out, link.edges[0]);
+      put<uint32_t> (out, link.edges[1]);
+    }
+  for (const AppSpec &app : spec.apps)
+    {
+      put<uint32_t> (out, app.host);
+      put<uint32_t> (out, app.remote);
+    }
+
+  // Concurrent runs of the same topology each write their own file
+  string tmpPath = path + "." + to_string (getpid ());
+  ofstream file (tmpPath, ios::binary);
+  if (!file.write (out.data (), out.size ()) || !file.flush ())
+    {
+      NS_LOG_WARN ("Cannot write " << tmpPath);
+      remove (tmpPath.c_str ());
+      return;
+    }
+  file.close ();
+
+  if (rename (tmpPath.c_str (), path.c_str ()))
+    {
+      NS_LOG_WARN ("Cannot write " << path);
+      remove (tmpPath.c_str ());
+    }
+}
+
+/*
+ * Reading, every read checks the bounds of the snapshot
+ */
+
+struct Reader
+{
+  const char *pos;
+  const char *end;
+
+  template <typename T>
+  bool
+  Get (T &value)
+  {
+    if (size_t (end - pos) < sizeof (T))
+      return false;
+    memcpy (&value, pos, sizeof (T));
+    pos += sizeof (T);
+    return true;
+  }
+
+  bool
+  GetString (string &str)
+  {
+    uint32_t size;
+    if (!Get (size) || size_t (end - pos) < size)
+      return false;
+    str.assign (pos, size);
+    pos += size;
+    return true;
+  }
+};
+
+static bool readTable (Reader &r, toml::table &tbl, uint32_t depth);
+static bool readArray (Reader &r, toml::array &arr, uint32_t depth);
+
+/**
+ * Read a tagged value and pass it to insert.
+ */
+template <typename Insert>
+static bool
+readNode (Reader &r, uint32_t depth, Insert insert)
+{
+  uint8_t tag;
+  if (!r.Get (tag))
+    return false;
+
+  switch (tag)
+    {
+      case TABLE: {
+        toml::table tbl;
+        if (!readTable (r, tbl, depth + 1))
+          return false;
+        insert (std::move (tbl));
+        return true;
+      }
+      case ARRAY: {
+        toml::array arr;
+        if (!readArray (r, arr, depth + 1))
+          return false;
+        insert (std::move (arr));
+        return true;
+      }
+      case STRING: {
+        string str;
+        if (!r.GetString (str))
+          return false;
+        insert (std::move (str));
+        return true;
+      }
+      case INTEGER: {
+        int64_t value;
+        if (!r.Get (value))
+          return false;
+        insert (value);
+        return true;
+      }
+      case FLOAT: {
+        double value;
+        if (!r.Get (value))
+          return false;
+        insert (value);
+        return true;
+      }
+      case BOOLEAN: {
+        uint8_t value;
+        if (!r.Get (value))
+          return false;
+        insert (value != 0);
+        return true;
+      }
+    default:
+      return false;
+    }
+}
+
+static bool
+readTable (Reader &r, toml::table &tbl, uint32_t depth)
+{
+  uint32_t size;
+  if (depth > MAX_DEPTH || !r.Get (size))
+    return false;
+
+  for (uint32_t i = 0; i < size; i++)
+    {
+      string key;
+      if (!r.GetString (key) ||
+          !readNode (r, depth, [&tbl, &key] (auto &&value) {
+            tbl.insert (key, std::forward<decltype (value)> (value));
+          }))
+        return false;
+    }
+  return tbl.size () == size;
+}
+
+static bool
+readArray (Reader &r, toml::array &arr, uint32_t depth)
+{
+  uint32_t size;
+  if (depth > MAX_DEPTH || !r.Get (size))
+    return false;
+
+  for (uint32_t i = 0; i < size; i++)
+    {
+      if (!readNode (r, depth, [&arr] (auto &&value) {
+            arr.push_back (std::forward<decltype (value)> (value));
+          }))
+        return false;
+    }
+  return true;
+}
+
+/**
+ * Rebuild the entries of a spec from its tables and the validated indices.
+ */
+static bool
+readEntries (Reader &r, TopologySpec &spec)
+{
+  uint32_t nNodes = spec.nodesTable.size ();
+
+  for (auto &&[key, value] : spec.nodesTable)
+    {
+      uint8_t host;
+      if (!value.is_table () || !r.Get (host))
+        return false;
+      spec.nodeIndex[key.str ()] = spec.nodes.size ();
+      spec.nodes.push_back ({key.str (), value.as_table (), host != 0});
+    }
+
+  for (auto &&[key, value] : spec.linksTable)
+    {
+      LinkSpec link = {key.str (), value.as_table (), {0, 0}};
+      if (!value.is_table () || !r.Get (link.edges[0]) || !r.Get (link.edges[1]) ||
+          link.edges[0] >= nNodes || link.edges[1] >= nNodes)
+        return false;
+      spec.links.push_back (link);
+    }
+
+  for (auto &&[key, value] : spec.appsTable)
+    {
+      AppSpec app = {key.str (), value.as_table (), "", 0, 0};
+      if (!value.is_table () || !r.Get (app.host) || !r.Get (app.remote) || app.host >= nNodes ||
+          app.remote >= nNodes)
+        return false;
+      app.type = (*app.configs)["type"].value_or (string_view ());
+      spec.apps.push_back (app);
+    }
+
+  return r.pos == r.end;
+}
+
+bool
+readSpecCache (std::string path, uint64_t key, TopologySpec &spec)
+{
+  string content;
+  if (!readFile (path, content))
+    return false;
+
+  Reader r = {content.data (), content.data () + content.size ()};
+  char magic[sizeof (SPEC_CACHE_MAGIC)];
+  uint32_t version;
+  uint64_t cachedKey;
+  if (!r.Get (magic) || memcmp (magic, SPEC_CACHE_MAGIC, sizeof (magic)) || !r.Get (version) ||
+      version != SPEC_CACHE_VERSION || !r.Get (cachedKey) || cachedKey != key)
+    {
+      NS_LOG_INFO ("Topology cache " << path << " is stale");
+      return false;
+    }
+
+  uint8_t hasDefaultTemplates, hasTemplates;
+  bool valid = readTable (r, spec.nodesTable, 0) && readTable (r, spec.linksTable, 0) &&
+               readTable (r, spec.appsTable, 0) && readTable (r, spec.configsTable, 0) &&
+               readTable (r, spec.defaultTemplatesTable, 0) &&
+               readTable (r, spec.templatesTable, 0) && r.Get (hasDefaultTemplates) &&
+               r.Get (hasTemplates) && readEntries (r, spec);
+
+  if (!valid)
+    {
+      NS_LOG_WARN ("Topology cache " << path << " is malformed");
+      spec = TopologySpec ();
+      return false;
+    }
+
+  spec.hasDefaultTemplates = hasDefaultTemplates;
+  spec.hasTemplates = hasTemplates;
+  NS_LOG_INFO ("Loaded topology cache " << path);
+  return true;
+}
+
+} // namespace ns3
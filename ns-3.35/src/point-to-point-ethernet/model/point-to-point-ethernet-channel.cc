@@ -16,6 +16,7 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <algorithm>
 #include "point-to-point-ethernet-channel.h"
 #include "point-to-point-ethernet-net-device.h"
 #include "ns3/trace-source-accessor.h"
@@ -58,7 +59,11 @@ PointToPointEthernetChannel::PointToPointEthernetChannel ()
 {
   NS_LOG_FUNCTION_NOARGS ();
   m_lastTime = Simulator::Now ();
-  m_bytesTransmitted = 0;
+  for (std::size_t i = 0; i < N_DEVICES; i++)
+    {
+      m_lastBusyTime[i] = Seconds (0);
+      m_directionUsage[i] = 0;
+    }
 }
 
 void
@@ -100,7 +105,6 @@ PointToPointEthernetChannel::TransmitStart (Ptr<const Packet> p,
 
   // Call the tx anim callback on the net device
   m_txrxPointToPointEthernet (p, src, m_link[wire].m_dst, txTime, txTime + m_delay);
-  m_bytesTransmitted += p->GetSize ();
   return true;
 }
 
@@ -169,12 +173,38 @@ PointToPointEthernetChannel::UpdateUsage ()
   if (delta.GetSeconds () > 0)
     {
       m_lastTime = Simulator::Now ();
-      uint64_t bits = m_bytesTransmitted * 8;
-      m_bytesTransmitted = 0;
-      m_usage = (bits / delta.GetSeconds ()) / GetDataRate ().GetBitRate ();
+      m_usage = 0;
+      for (std::size_t i = 0; i < N_DEVICES; i++)
+        {
+          Time busyTime = GetBusyTime (i);
+          m_directionUsage[i] = (busyTime - m_lastBusyTime[i]).GetSeconds () / delta.GetSeconds ();
+          m_lastBusyTime[i] = busyTime;
+          m_usage = std::max (m_usage, m_directionUsage[i]);
+        }
     }
 }
 
+double
+PointToPointEthernetChannel::GetDirectionUsage (std::size_t direction)
+{
+  NS_ASSERT (direction < N_DEVICES);
+  return m_directionUsage[direction];
+}
+
+Time
+PointToPointEthernetChannel::GetBusyTime (std::size_t direction) const
+{
+  NS_ASSERT (direction < N_DEVICES);
+  return m_link[direction].m_src->GetTxBusyTime ();
+}
+
+double
+PointToPointEthernetChannel::GetUsageEwma (std::size_t direction) const
+{
+  NS_ASSERT (direction < N_DEVICES);
+  return m_link[direction].m_src->GetTxUsageEwma ();
+}
+
 DataRate
 PointToPointEthernetChannel::GetDataRate ()
 {
@@ -102,9 +102,33 @@ public:
   virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
   virtual NetDeviceContainer GetDevices () const;
 
+  /**
+   * \brief Compute the usage of each direction since the last update, from
+   * the time its source device spent transmitting. The channel usage is
+   * that of the busiest direction.
+   */
   void UpdateUsage (void);
   DataRate GetDataRate (void);
 
+  /**
+   * \param direction Index of the source device
+   * \returns The usage of a direction over the last update interval
+   */
+  double GetDirectionUsage (std::size_t direction);
+
+  /**
+   * \param direction Index of the source device
+   * \returns The time the direction was busy so far, exact at any time
+   */
+  Time GetBusyTime (std::size_t direction) const;
+
+  /**
+   * \param direction Index of the source device
+   * \returns The moving average of the usage of a direction, see
+   * PointToPointEthernetNetDevice::GetTxUsageEwma
+   */
+  double GetUsageEwma (std::size_t direction) const;
+
 protected:
   /**
    * \brief Get the delay associated with this channel
@@ -153,7 +177,8 @@ private:
   static const std::size_t N_DEVICES = 2;
 
   Time m_lastTime;
-  uint64_t m_bytesTransmitted;
+  Time m_lastBusyTime[N_DEVICES]; //!< Per direction, at the last update
+  double m_directionUsage[N_DEVICES]; //!< Per direction, over the last update interval
 
   Time m_delay; //!< Propagation delay
   std::size_t m_nDevices; //!< Devices of this channel
@@ -16,6 +16,7 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <cmath>
 #include "ns3/log.h"
 #include "ns3/queue.h"
 #include "ns3/simulator.h"
@@ -65,6 +66,11 @@ PointToPointEthernetNetDevice::GetTypeId (void)
                          TimeValue (Seconds (0.0)),
                          MakeTimeAccessor (&PointToPointEthernetNetDevice::m_tInterframeGap),
                          MakeTimeChecker ())
+          .AddAttribute ("UsageTimeConstant",
+                         "The time constant of the moving average of the transmission usage",
+                         TimeValue (Seconds (1.0)),
+                         MakeTimeAccessor (&PointToPointEthernetNetDevice::m_usageTimeConstant),
+                         MakeTimeChecker (NanoSeconds (1)))
 
           //
           // Transmit queueing discipline for the device which includes its own set
@@ -135,6 +141,12 @@ PointToPointEthernetNetDevice::GetTypeId (void)
               "dropped by the device during transmission",
               MakeTraceSourceAccessor (&PointToPointEthernetNetDevice::m_phyTxDropTrace),
               "ns3::Packet::TracedCallback")
+          .AddTraceSource (
+              "TxQueueEmpty",
+              "Trace source indicating the transmitter went idle "
+              "with an empty queue",
+              MakeTraceSourceAccessor (&PointToPointEthernetNetDevice::m_txQueueEmptyTrace),
+              "ns3::TracedCallback::Void")
 #if 0
     // Not currently implemented for this device
     .AddTraceSource ("PhyRxBegin", 
@@ -176,7 +188,11 @@ PointToPointEthernetNetDevice::GetTypeId (void)
 }
 
 PointToPointEthernetNetDevice::PointToPointEthernetNetDevice ()
-    : m_txMachineState (READY), m_channel (0), m_linkUp (false), m_currentPkt (0)
+    : m_txMachineState (READY),
+      m_txUsageEwma (0),
+      m_channel (0),
+      m_linkUp (false),
+      m_currentPkt (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -291,6 +307,7 @@ PointToPointEthernetNetDevice::TransmitStart (Ptr<Packet> p)
 
   Time txTime = m_bps.CalculateBytesTxTime (p->GetSize ());
   Time txCompleteTime = txTime + m_tInterframeGap;
+  AccountTransmission (txTime);
 
   NS_LOG_LOGIC ("Schedule TransmitCompleteEvent in " << txCompleteTime.As (Time::S));
   Simulator::Schedule (txCompleteTime, &PointToPointEthernetNetDevice::TransmitComplete, this);
@@ -323,13 +340,24 @@ PointToPointEthernetNetDevice::TransmitComplete (void)
   m_phyTxEndTrace (m_currentPkt);
   m_currentPkt = 0;
 
-  Ptr<Packet> p = m_queue->Dequeue ();
-  if (p == 0)
+  if (m_queue->IsEmpty ())
     {
       NS_LOG_LOGIC ("No pending packets in device queue after tx complete");
+      m_txQueueEmptyTrace ();
+      return;
+    }
+
+  if (Simulator::Now () < m_txHoldTime)
+    {
+      NS_LOG_LOGIC ("Transmissions held until " << m_txHoldTime.As (Time::S));
+      m_txMachineState = BUSY;
+      Simulator::Schedule (m_txHoldTime - Simulator::Now (),
+                           &PointToPointEthernetNetDevice::TransmitResume, this);
       return;
     }
 
+  Ptr<Packet> p = m_queue->Dequeue ();
+
   //
   // Got another packet off of the queue, so start the transmit process again.
   //
@@ -338,6 +366,79 @@ PointToPointEthernetNetDevice::TransmitComplete (void)
   TransmitStart (p);
 }
 
+void
+PointToPointEthernetNetDevice::TransmitResume (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_txMachineState == BUSY, "Must be BUSY while transmissions are held");
+
+  // The hold may have been extended in the meantime
+  if (Simulator::Now () < m_txHoldTime)
+    {
+      Simulator::Schedule (m_txHoldTime - Simulator::Now (),
+                           &PointToPointEthernetNetDevice::TransmitResume, this);
+      return;
+    }
+
+  m_txMachineState = READY;
+  Ptr<Packet> p = m_queue->Dequeue ();
+  if (p == 0)
+    {
+      m_txQueueEmptyTrace ();
+      return;
+    }
+
+  m_snifferTrace (p);
+  m_promiscSnifferTrace (p);
+  TransmitStart (p);
+}
+
+void
+PointToPointEthernetNetDevice::HoldTransmissions (Time until)
+{
+  NS_LOG_FUNCTION (this << until.As (Time::S));
+  m_txHoldTime = Max (m_txHoldTime, until);
+}
+
+bool
+PointToPointEthernetNetDevice::IsTxIdle (void) const
+{
+  return m_txMachineState == READY && m_queue->IsEmpty ();
+}
+
+Time
+PointToPointEthernetNetDevice::GetTxBusyTime (void) const
+{
+  // Without the part of the current transmission yet to come
+  return m_txBusyTime - Max (m_txEnd - Simulator::Now (), Seconds (0));
+}
+
+double
+PointToPointEthernetNetDevice::GetTxUsageEwma (void) const
+{
+  //
+  // The device was busy from the start of the last transmission to its end
+  // and idle since, the average decays over both and gains the weight of
+  // the busy part.
+  //
+  Time now = Simulator::Now ();
+  double tau = m_usageTimeConstant.GetSeconds ();
+  double decay = std::exp (-(now - m_txUsageEwmaTime).GetSeconds () / tau);
+  double busy = 0;
+  if (m_txEnd > m_txUsageEwmaTime)
+    busy = std::exp (-(now - Min (m_txEnd, now)).GetSeconds () / tau) - decay;
+  return m_txUsageEwma * decay + busy;
+}
+
+void
+PointToPointEthernetNetDevice::AccountTransmission (Time txTime)
+{
+  m_txUsageEwma = GetTxUsageEwma ();
+  m_txUsageEwmaTime = Simulator::Now ();
+  m_txBusyTime += txTime;
+  m_txEnd = Simulator::Now () + txTime;
+}
+
 bool
 PointToPointEthernetNetDevice::Attach (Ptr<PointToPointEthernetChannel> ch)
 {
@@ -636,6 +737,13 @@ PointToPointEthernetNetDevice::SendFrom (Ptr<Packet> packet, const Address &sour
       //
       // If the channel is ready for transition we send the packet right now
       //
+      if (m_txMachineState == READY && Simulator::Now () < m_txHoldTime)
+        {
+          m_txMachineState = BUSY;
+          Simulator::Schedule (m_txHoldTime - Simulator::Now (),
+                               &PointToPointEthernetNetDevice::TransmitResume, this);
+          return true;
+        }
       if (m_txMachineState == READY)
         {
           packet = m_queue->Dequeue ();
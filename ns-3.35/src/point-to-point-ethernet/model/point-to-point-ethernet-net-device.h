@@ -203,6 +203,35 @@ public:
   void SetLinkDown ();
   void SetLinkUp ();
 
+  /**
+   * Hold the transmissions that would start before the given time, e.g.
+   * while the PHY wakes up from low power idle or changes its rate.
+   * Packets keep being queued meanwhile.
+   *
+   * \param until the time at which transmissions may resume
+   */
+  void HoldTransmissions (Time until);
+
+  /**
+   * \returns true if the device is neither transmitting nor holding
+   * packets in its queue
+   */
+  bool IsTxIdle (void) const;
+
+  /**
+   * \returns the time spent transmitting, from the start of the simulation
+   * up to now. The usage over any interval is the difference of the
+   * readings at its ends over its length.
+   */
+  Time GetTxBusyTime (void) const;
+
+  /**
+   * \returns the exponentially weighted moving average of the fraction of
+   * time spent transmitting, with the UsageTimeConstant attribute as time
+   * constant
+   */
+  double GetTxUsageEwma (void) const;
+
 protected:
   /**
    * \brief Handler for MPI receive event
@@ -286,6 +315,19 @@ private:
    */
   void TransmitComplete (void);
 
+  /**
+   * Account a transmission starting now in the busy time and its average.
+   *
+   * \param txTime the transmission time of the packet
+   */
+  void AccountTransmission (Time txTime);
+
+  /**
+   * Start transmitting the head of the queue once the transmission hold
+   * set by HoldTransmissions () is over.
+   */
+  void TransmitResume (void);
+
   /**
    * \brief Make the link up and running
    *
@@ -317,6 +359,17 @@ private:
    */
   Time m_tInterframeGap;
 
+  /**
+   * Transmissions are held until this time
+   */
+  Time m_txHoldTime;
+
+  Time m_txBusyTime; //!< Transmission time so far, the current transmission in full
+  Time m_txEnd; //!< End of the last transmission
+  double m_txUsageEwma; //!< Moving average at the start of the last transmission
+  Time m_txUsageEwmaTime; //!< Start of the last transmission
+  Time m_usageTimeConstant; //!< Of the moving average
+
   /**
    * The PointToPointEthernetChannel to which this PointToPointEthernetNetDevice has been
    * attached.
@@ -389,6 +442,12 @@ private:
    */
   TracedCallback<Ptr<const Packet>> m_phyTxDropTrace;
 
+  /**
+   * The trace source fired when the transmitter goes idle with an empty
+   * queue.
+   */
+  TracedCallback<> m_txQueueEmptyTrace;
+
   /**
    * The trace source fired when a packet begins the reception process from
    * the medium -- when the simulated first bit(s) arrive.
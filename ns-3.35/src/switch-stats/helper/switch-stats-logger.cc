@@ -25,17 +25,17 @@
 
 namespace ns3 {
 
-Ptr<OutputStreamWrapper> SwitchStatsLogger::m_streamWrapper = NULL;
+Ptr<TraceWriter> SwitchStatsLogger::m_writer = NULL;
 NodeContainer SwitchStatsLogger::m_nodes = NodeContainer ();
+std::vector<uint32_t> SwitchStatsLogger::m_entities = std::vector<uint32_t> ();
 
-SwitchStatsLogger::SwitchStatsLogger ()
+SwitchStatsLogger::SwitchStatsLogger () : SwitchStatsLogger ("switch-stats")
 {
-  SwitchStatsLogger ("switch-stats.csv");
 }
 
-SwitchStatsLogger::SwitchStatsLogger (std::string path)
+SwitchStatsLogger::SwitchStatsLogger (std::string path, std::string format)
 {
-  m_streamWrapper = Create<OutputStreamWrapper> (path, std::ios::out);
+  m_writer = Create<TraceWriter> (path, format, SwitchStats::GetTraceSchema ());
 }
 
 SwitchStatsLogger::~SwitchStatsLogger ()
@@ -48,14 +48,14 @@ SwitchStatsLogger::LogStats (Time interval, Time stop, Ptr<Node> node)
   Ptr<SwitchStats> stats = node->GetObject<SwitchStats> ();
 
   if (stats)
-    stats->GetStatsLog (interval, stop, m_streamWrapper);
+    stats->GetStatsLog (interval, stop, m_writer);
 }
 
 void
 SwitchStatsLogger::Log ()
 {
-  for (NodeContainer::Iterator i = m_nodes.Begin (); i != m_nodes.End (); ++i)
-    (*i)->GetObject<SwitchStats> ()->LogStats (m_streamWrapper);
+  for (uint32_t i = 0; i < m_nodes.GetN (); i++)
+    m_nodes.Get (i)->GetObject<SwitchStats> ()->LogStats (m_writer, m_entities[i]);
 }
 
 void
@@ -66,12 +66,12 @@ SwitchStatsLogger::LogStats (Time interval, Time stop, NodeContainer c)
       Ptr<SwitchStats> stats = (*i)->GetObject<SwitchStats> ();
 
       if (stats)
-        m_nodes.Add (*i);
+        {
+          m_nodes.Add (*i);
+          m_entities.push_back (m_writer->AddEntity (stats->GetNodeName ()));
+        }
     }
 
-  std::ostream *stream = m_streamWrapper->GetStream ();
-  *stream << "Time;NodeName;CPU_Usage;NrProccessedPackets;NrDroppedPackets;ProccessedBytes\n";
-
   Time i = Seconds (0.0);
   while (i <= stop)
     {
@@ -86,4 +86,10 @@ SwitchStatsLogger::LogStatsAll (Time interval, Time stop)
   LogStats (interval, stop, NodeContainer::GetGlobalSwitches ());
 }
 
+void
+SwitchStatsLogger::SetWindow (TraceWindow window)
+{
+  m_writer->SetWindow (window);
+}
+
 } // namespace ns3
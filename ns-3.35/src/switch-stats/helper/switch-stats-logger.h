@@ -24,7 +24,7 @@
 #define SWITCH_STATS_LOGGER
 
 #include "ns3/core-module.h"
-#include "ns3/output-stream-wrapper.h"
+#include "ns3/trace-writer.h"
 #include "ns3/node-container.h"
 
 namespace ns3 {
@@ -33,16 +33,22 @@ class SwitchStatsLogger : public Object
 {
 public:
   SwitchStatsLogger ();
-  SwitchStatsLogger (std::string path);
+  SwitchStatsLogger (std::string path, std::string format = "csv");
   virtual ~SwitchStatsLogger ();
 
   void LogStats (Time interval, Time stop, Ptr<Node> node);
   void LogStats (Time interval, Time stop, NodeContainer c);
   void LogStatsAll (Time interval, Time stop);
 
+  /**
+   * Log the summaries of the stats over windows.
+   */
+  void SetWindow (TraceWindow window);
+
 private:
-  static Ptr<OutputStreamWrapper> m_streamWrapper;
+  static Ptr<TraceWriter> m_writer;
   static NodeContainer m_nodes;
+  static std::vector<uint32_t> m_entities; //!< Trace entity of each logged node
   void Log ();
 };
 
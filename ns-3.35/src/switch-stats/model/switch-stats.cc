@@ -30,11 +30,18 @@ TypeId
 SwitchStats::GetTypeId (void)
 {
   static TypeId tid =
-      TypeId ("ns3::SwitchStats").SetParent<Object> ().AddConstructor<SwitchStats> ();
+      TypeId ("ns3::SwitchStats")
+          .SetParent<Object> ()
+          .AddConstructor<SwitchStats> ()
+          .AddAttribute ("HistorySize", "The logged intervals kept for queries.",
+                         UintegerValue (512),
+                         MakeUintegerAccessor (&SwitchStats::SetHistorySize,
+                                               &SwitchStats::GetHistorySize),
+                         MakeUintegerChecker<uint32_t> ());
   return tid;
 }
 
-SwitchStats::SwitchStats ()
+SwitchStats::SwitchStats () : m_history (0)
 {
   m_packets = 0;
   m_droppedPackets = 0;
@@ -45,6 +52,16 @@ SwitchStats::~SwitchStats ()
 {
 }
 
+TraceSchema
+SwitchStats::GetTraceSchema (void)
+{
+  return {"NodeName",
+          {{"CPU_Usage", TraceColumn::REAL},
+           {"NrProccessedPackets", TraceColumn::INTEGER},
+           {"NrDroppedPackets", TraceColumn::INTEGER},
+           {"ProccessedBytes", TraceColumn::INTEGER}}};
+}
+
 void
 SwitchStats::SetNode (Ptr<Node> node)
 {
@@ -58,25 +75,31 @@ SwitchStats::SetNode (Ptr<Node> node)
                                         MakeCallback (&SwitchStats::HandleDroppedPacket, this));
 }
 
+std::string
+SwitchStats::GetNodeName (void) const
+{
+  return m_nodeName;
+}
+
 void
-SwitchStats::GetStatsLog (Time interval, Time stop, Ptr<OutputStreamWrapper> streamWrapper)
+SwitchStats::GetStatsLog (Time interval, Time stop, Ptr<TraceWriter> writer)
 {
+  uint32_t entity = writer->AddEntity (m_nodeName);
+
   Time i = Seconds (0.0);
   while (i <= stop)
     {
-      Simulator::Schedule (i, &SwitchStats::LogStats, this, streamWrapper);
+      Simulator::Schedule (i, &SwitchStats::LogStats, this, writer, entity);
       i += interval;
     }
 }
 
 void
-SwitchStats::LogStats (Ptr<OutputStreamWrapper> streamWrapper)
+SwitchStats::LogStats (Ptr<TraceWriter> writer, uint32_t entity)
 {
-  std::ostream *stream = streamWrapper->GetStream ();
-
-  *stream << std::fixed << Simulator::Now ().GetSeconds () << ";" << m_nodeName << ";"
-          << m_device->GetCpuUsage () << ";" << m_packets << ";" << m_droppedPackets << ";"
-          << m_bytes << "\n";
+  SwitchStatsSample sample = {m_device->GetCpuUsage (), m_packets, m_droppedPackets, m_bytes};
+  m_history.Append (Simulator::Now (), sample);
+  writer->Write (entity, {sample.cpuUsage, sample.packets, sample.droppedPackets, sample.bytes});
 
   // Restart counters
   m_packets = 0;
@@ -84,6 +107,46 @@ SwitchStats::LogStats (Ptr<OutputStreamWrapper> streamWrapper)
   m_bytes = 0;
 }
 
+double
+SwitchStats::GetCpuUsage (Time window) const
+{
+  uint32_t n = m_history.CountSince (Simulator::Now () - window);
+  if (!n)
+    return 0;
+
+  double sum = 0;
+  for (uint32_t age = 0; age < n; age++)
+    sum += m_history.Get (age).value.cpuUsage;
+  return sum / n;
+}
+
+std::vector<MetricHistory<double>::Sample>
+SwitchStats::GetCpuUsageSeries (uint32_t n) const
+{
+  std::vector<MetricHistory<double>::Sample> series;
+  for (const MetricHistory<SwitchStatsSample>::Sample &sample : m_history.GetLast (n))
+    series.push_back ({sample.time, sample.value.cpuUsage});
+  return series;
+}
+
+std::vector<MetricHistory<SwitchStatsSample>::Sample>
+SwitchStats::GetStatsSeries (uint32_t n) const
+{
+  return m_history.GetLast (n);
+}
+
+void
+SwitchStats::SetHistorySize (uint32_t size)
+{
+  m_history.SetCapacity (size);
+}
+
+uint32_t
+SwitchStats::GetHistorySize (void) const
+{
+  return m_history.GetCapacity ();
+}
+
 void
 SwitchStats::HandlePipelinePacket (Ptr<const Packet> packet)
 {
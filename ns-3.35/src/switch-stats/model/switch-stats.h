@@ -25,10 +25,22 @@
 #include "ns3/core-module.h"
 #include "ns3/node.h"
 #include "ns3/ofswitch13-device.h"
-#include "ns3/output-stream-wrapper.h"
+#include "ns3/metric-history.h"
+#include "ns3/trace-writer.h"
 
 namespace ns3 {
 
+/**
+ * The stats of a switch over a log interval.
+ */
+struct SwitchStatsSample
+{
+  double cpuUsage;
+  uint32_t packets;
+  uint32_t droppedPackets;
+  uint32_t bytes;
+};
+
 class SwitchStats : public Object
 {
 public:
@@ -36,17 +48,40 @@ public:
   SwitchStats ();
   virtual ~SwitchStats ();
 
+  static TraceSchema GetTraceSchema (void);
+
   void SetNode (Ptr<Node> node);
-  void GetStatsLog (Time interval, Time stop, Ptr<OutputStreamWrapper> streamWrapper);
-  void LogStats (Ptr<OutputStreamWrapper> streamWrapper);
+  std::string GetNodeName (void) const;
+  void GetStatsLog (Time interval, Time stop, Ptr<TraceWriter> writer);
+  void LogStats (Ptr<TraceWriter> writer, uint32_t entity);
+
+  /**
+   * \returns The mean CPU usage of the intervals logged in the last window,
+   * 0 without any.
+   */
+  double GetCpuUsage (Time window) const;
+
+  /**
+   * \returns Up to the n last logged CPU usages, oldest first.
+   */
+  std::vector<MetricHistory<double>::Sample> GetCpuUsageSeries (uint32_t n) const;
+
+  /**
+   * \returns Up to the n last logged intervals, oldest first.
+   */
+  std::vector<MetricHistory<SwitchStatsSample>::Sample> GetStatsSeries (uint32_t n) const;
 
 private:
+  void SetHistorySize (uint32_t size);
+  uint32_t GetHistorySize (void) const;
+
   uint32_t m_packets;
   uint32_t m_droppedPackets;
   uint32_t m_bytes;
   std::string m_nodeName;
   Ptr<Node> m_node;
   Ptr<OFSwitch13Device> m_device;
+  MetricHistory<SwitchStatsSample> m_history;
 
   void HandlePipelinePacket (Ptr<const Packet> packet);
   void HandleDroppedPacket (Ptr<const Packet> packet);
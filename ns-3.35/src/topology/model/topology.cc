@@ -23,6 +23,7 @@
 #include "topology.h"
 #include <boost/graph/detail/adjacency_list.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/filtered_graph.hpp>
 #include <boost/graph/properties.hpp>
 
 namespace ns3 {
@@ -36,6 +37,32 @@ std::map<Vertex, Ptr<Node>> Topology::m_nodes = std::map<Vertex, Ptr<Node>> ();
 std::map<Ipv4Address, Vertex> Topology::m_ip_to_vertex = std::map<Ipv4Address, Vertex> ();
 std::map<Vertex, Ipv4Address> Topology::m_vertex_to_ip = std::map<Vertex, Ipv4Address> ();
 std::map<Edge, Ptr<Channel>> Topology::m_channels = std::map<Edge, Ptr<Channel>> ();
+std::vector<Topology::Prefix> Topology::m_prefixes = std::vector<Prefix> ();
+std::map<Ipv4Address, uint32_t> Topology::m_networkToPrefix = std::map<Ipv4Address, uint32_t> ();
+std::vector<Ipv4Mask> Topology::m_prefixMasks = std::vector<Ipv4Mask> ();
+std::set<std::pair<Vertex, Vertex>> Topology::m_downLinks = std::set<std::pair<Vertex, Vertex>> ();
+
+static const std::pair<Vertex, Vertex> NO_LINK (graph_traits<Graph>::null_vertex (),
+                                                graph_traits<Graph>::null_vertex ());
+
+/**
+ * Hides the links that are down, and the one to avoid, from path computations.
+ */
+struct LinkFilter
+{
+  const Graph *graph;
+  const std::set<std::pair<Vertex, Vertex>> *down;
+  std::pair<Vertex, Vertex> avoid;
+
+  bool
+  operator() (const Edge &e) const
+  {
+    std::pair<Vertex, Vertex> link = std::minmax (source (e, *graph), target (e, *graph));
+    return link != avoid && !down->count (link);
+  }
+};
+
+typedef filtered_graph<Graph, LinkFilter> UpGraph;
 
 TypeId
 Topology::GetTypeId (void)
@@ -75,6 +102,35 @@ Topology::AddHost (Ptr<Node> host, Ipv4Address ip)
   m_vertex_to_ip[vd] = ip;
 }
 
+void
+Topology::AddPrefix (Ipv4Address network, Ipv4Mask mask, Ptr<Node> sw)
+{
+  NS_ABORT_MSG_IF (m_networkToPrefix.count (network), "Prefix " << network << " already added");
+
+  m_networkToPrefix[network] = m_prefixes.size ();
+  m_prefixes.push_back ({network, mask, sw});
+  if (std::find (m_prefixMasks.begin (), m_prefixMasks.end (), mask) == m_prefixMasks.end ())
+    m_prefixMasks.push_back (mask);
+}
+
+const std::vector<Topology::Prefix> &
+Topology::GetPrefixes (void)
+{
+  return m_prefixes;
+}
+
+Ptr<Node>
+Topology::GetPrefixSwitch (Ipv4Address ip)
+{
+  for (Ipv4Mask mask : m_prefixMasks)
+    {
+      auto it = m_networkToPrefix.find (ip.CombineMask (mask));
+      if (it != m_networkToPrefix.end () && m_prefixes[it->second].mask == mask)
+        return m_prefixes[it->second].sw;
+    }
+  return 0;
+}
+
 void
 Topology::AddLink (Ptr<Node> n1, Ptr<Node> n2, Ptr<Channel> channel)
 {
@@ -84,11 +140,18 @@ Topology::AddLink (Ptr<Node> n1, Ptr<Node> n2, Ptr<Channel> channel)
   m_channels[e] = channel;
 }
 
+std::pair<Vertex, Vertex>
+Topology::GetLink (Vertex v1, Vertex v2)
+{
+  return std::minmax (v1, v2);
+}
+
 std::vector<Vertex>
-Topology::DijkstraShortestPathsInternal (Vertex src)
+Topology::DijkstraShortestPathsInternal (Vertex src, std::pair<Vertex, Vertex> avoid)
 {
+  UpGraph graph (m_graph, LinkFilter{&m_graph, &m_downLinks, avoid});
   std::vector<Vertex> predecessors (num_vertices (m_graph));
-  dijkstra_shortest_paths (m_graph, src,
+  dijkstra_shortest_paths (graph, src,
                            predecessor_map (boost::make_iterator_property_map (
                                predecessors.begin (), get (boost::vertex_index, m_graph)))
 
@@ -97,12 +160,16 @@ Topology::DijkstraShortestPathsInternal (Vertex src)
 }
 
 std::vector<Vertex>
-Topology::DijkstraShortestPathInternal (Vertex src, Vertex dst)
+Topology::DijkstraShortestPathInternal (Vertex src, Vertex dst, std::pair<Vertex, Vertex> avoid)
 {
-  std::vector<Vertex> predecessors = DijkstraShortestPathsInternal (src);
+  std::vector<Vertex> predecessors = DijkstraShortestPathsInternal (src, avoid);
   std::vector<Vertex> path;
   Vertex currentVertex = dst;
 
+  // Unreachable vertices are their own predecessor
+  if (dst != src && predecessors[dst] == dst)
+    return path;
+
   while (currentVertex != src)
     {
       path.push_back (currentVertex);
@@ -126,7 +193,14 @@ Topology::VertexToNode (std::vector<Vertex> path)
 std::vector<Ptr<Node>>
 Topology::DijkstraShortestPath (Ptr<Node> src, Ptr<Node> dst)
 {
-  return VertexToNode (DijkstraShortestPathInternal (m_vertexes[src], m_vertexes[dst]));
+  return VertexToNode (DijkstraShortestPathInternal (m_vertexes[src], m_vertexes[dst], NO_LINK));
+}
+
+std::vector<Ptr<Node>>
+Topology::DijkstraShortestPath (Ptr<Node> src, Ptr<Node> dst, Ptr<Node> n1, Ptr<Node> n2)
+{
+  return VertexToNode (DijkstraShortestPathInternal (m_vertexes[src], m_vertexes[dst],
+                                                     GetLink (m_vertexes[n1], m_vertexes[n2])));
 }
 
 std::vector<Ptr<Node>>
@@ -158,7 +232,7 @@ Topology::DijkstraShortestPath (std::string src, std::string dst)
 std::vector<Ptr<Node>>
 Topology::DijkstraShortestPaths (Ptr<Node> src)
 {
-  return VertexToNode (DijkstraShortestPathsInternal (m_vertexes[src]));
+  return VertexToNode (DijkstraShortestPathsInternal (m_vertexes[src], NO_LINK));
 }
 
 std::vector<Ptr<Node>>
@@ -237,6 +311,37 @@ Topology::NodeToVertex (Ptr<Node> node)
   return m_vertexes[node];
 }
 
+std::vector<std::pair<Ptr<Node>, int>>
+Topology::NextHops (Ptr<Node> src, Ptr<Node> dst, bool equalCost)
+{
+  UpGraph graph (m_graph, LinkFilter{&m_graph, &m_downLinks, NO_LINK});
+  std::vector<int> distances (num_vertices (m_graph));
+  Vertex source = NodeToVertex (src);
+  Vertex target = NodeToVertex (dst);
+
+  dijkstra_shortest_paths (graph, target,
+                           distance_map (make_iterator_property_map (
+                               distances.begin (), get (vertex_index, m_graph))));
+
+  // Only neighbours strictly closer to dst, so zero weights cannot loop
+  std::vector<std::pair<Ptr<Node>, int>> hops;
+  boost::graph_traits<UpGraph>::out_edge_iterator edgeIt, edgeEnd;
+  for (boost::tie (edgeIt, edgeEnd) = out_edges (source, graph); edgeIt != edgeEnd; ++edgeIt)
+    {
+      Vertex v = boost::target (*edgeIt, m_graph);
+      if (distances[v] >= distances[source])
+        continue;
+
+      int cost = GetEdgeWeight (*edgeIt) + distances[v];
+      if (equalCost && cost != distances[source])
+        continue;
+
+      hops.emplace_back (VertexToNode (v), cost);
+    }
+
+  return hops;
+}
+
 void
 Topology::UpdateEdgeWeight (Ptr<Node> n1, Ptr<Node> n2, int newWeight)
 {
@@ -271,6 +376,21 @@ Topology::GetEdgeWeight (Edge e)
   return get (edge_weight_t (), m_graph, e);
 }
 
+bool
+Topology::SetLinkUp (Ptr<Node> n1, Ptr<Node> n2, bool up)
+{
+  std::pair<Vertex, Vertex> link = GetLink (m_vertexes[n1], m_vertexes[n2]);
+  if (up)
+    return m_downLinks.erase (link);
+  return m_downLinks.insert (link).second;
+}
+
+bool
+Topology::IsLinkUp (Ptr<Node> n1, Ptr<Node> n2)
+{
+  return !m_downLinks.count (GetLink (m_vertexes[n1], m_vertexes[n2]));
+}
+
 Ptr<Channel>
 Topology::GetChannel (Ptr<Node> n1, Ptr<Node> n2)
 {
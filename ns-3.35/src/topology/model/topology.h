@@ -25,6 +25,8 @@
 
 #include "ns3/core-module.h"
 #include "ns3/node.h"
+#include "ns3/ipv4-address.h"
+#include <set>
 #include <boost/graph/adjacency_list.hpp>
 #include "ns3/channel.h"
 
@@ -39,6 +41,16 @@ typedef graph_traits<Graph>::edge_descriptor Edge;
 class Topology : public Object
 {
 public:
+  /**
+   * Subnet of the hosts attached to an edge switch.
+   */
+  struct Prefix
+  {
+    Ipv4Address network;
+    Ipv4Mask mask;
+    Ptr<Node> sw;
+  };
+
   static TypeId GetTypeId (void);
   Topology ();
   ~Topology ();
@@ -47,11 +59,35 @@ public:
   static void AddHost (Ptr<Node> host, Ipv4Address ip);
   static void AddLink (Ptr<Node> n1, Ptr<Node> n2, Ptr<Channel> channel);
 
+  /**
+   * Record the subnet of the hosts attached to a switch, for controllers to
+   * route on prefixes instead of single hosts.
+   */
+  static void AddPrefix (Ipv4Address network, Ipv4Mask mask, Ptr<Node> sw);
+
+  /**
+   * \returns The recorded prefixes, in allocation order.
+   */
+  static const std::vector<Prefix> &GetPrefixes (void);
+
+  /**
+   * \returns The switch of the prefix holding ip, or 0 if there is none.
+   */
+  static Ptr<Node> GetPrefixSwitch (Ipv4Address ip);
+
+  /**
+   * Paths only use links that are up, they are empty if dst is unreachable.
+   */
   static std::vector<Ptr<Node>> DijkstraShortestPath (Ptr<Node> src, Ptr<Node> dst);
   static std::vector<Ptr<Node>> DijkstraShortestPath (Ptr<Node> src, Ipv4Address dst);
   static std::vector<Ptr<Node>> DijkstraShortestPath (Ipv4Address src, Ptr<Node> dst);
   static std::vector<Ptr<Node>> DijkstraShortestPath (Ipv4Address src, Ipv4Address dst);
   static std::vector<Ptr<Node>> DijkstraShortestPath (std::string src, std::string dst);
+  /**
+   * \returns The shortest path from src to dst without the link n1-n2.
+   */
+  static std::vector<Ptr<Node>> DijkstraShortestPath (Ptr<Node> src, Ptr<Node> dst, Ptr<Node> n1,
+                                                      Ptr<Node> n2);
   static std::vector<Ptr<Node>> DijkstraShortestPaths (Ptr<Node> src);
   static std::vector<Ptr<Node>> DijkstraShortestPaths (Ipv4Address src);
   static std::vector<Ptr<Node>> DijkstraShortestPaths (std::string src);
@@ -59,9 +95,25 @@ public:
   static std::vector<std::pair<std::vector<Ptr<Node>>, int>> DijkstraShortestPaths (Ptr<Node> src,
                                                                                     Ptr<Node> dst);
 
+  /**
+   * \returns The neighbours of src through which dst can be reached without
+   * loops, with the cost of the shortest path through each. With equalCost,
+   * only the neighbours on a shortest path.
+   */
+  static std::vector<std::pair<Ptr<Node>, int>> NextHops (Ptr<Node> src, Ptr<Node> dst,
+                                                          bool equalCost);
+
   static void UpdateEdgeWeight (Ptr<Node> n1, Ptr<Node> n2, int newWeight);
   static int GetEdgeWeight (Ptr<Node> n1, Ptr<Node> n2);
 
+  /**
+   * Bring a link down, hiding it from path computations, or back up.
+   *
+   * \returns Whether the state of the link changed.
+   */
+  static bool SetLinkUp (Ptr<Node> n1, Ptr<Node> n2, bool up);
+  static bool IsLinkUp (Ptr<Node> n1, Ptr<Node> n2);
+
   static Graph GetGraph ();
 
   static Ptr<Node> VertexToNode (Vertex vd);
@@ -80,9 +132,16 @@ private:
   static std::map<Ipv4Address, Vertex> m_ip_to_vertex;
   static std::map<Vertex, Ipv4Address> m_vertex_to_ip;
   static std::map<Edge, Ptr<Channel>> m_channels;
-
-  static std::vector<Vertex> DijkstraShortestPathsInternal (Vertex src);
-  static std::vector<Vertex> DijkstraShortestPathInternal (Vertex src, Vertex dst);
+  static std::vector<Prefix> m_prefixes;
+  static std::map<Ipv4Address, uint32_t> m_networkToPrefix;
+  static std::vector<Ipv4Mask> m_prefixMasks; //!< Distinct masks of the prefixes
+  static std::set<std::pair<Vertex, Vertex>> m_downLinks; //!< Lowest vertex first
+
+  static std::pair<Vertex, Vertex> GetLink (Vertex v1, Vertex v2);
+  static std::vector<Vertex> DijkstraShortestPathsInternal (Vertex src,
+                                                            std::pair<Vertex, Vertex> avoid);
+  static std::vector<Vertex> DijkstraShortestPathInternal (Vertex src, Vertex dst,
+                                                           std::pair<Vertex, Vertex> avoid);
   static void UpdateEdgeWeight (Edge ed, int newWeight);
   static int GetEdgeWeight (Edge ed);
 
@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/trace-writer-config.h"
+#include "binary-trace-format.h"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace ns3 {
+
+const char BinaryTraceFormat::MAGIC[8] = {'F', 'X', 'T', 'R', 'A', 'C', 'E', '\0'};
+
+template <typename T>
+static void
+put (std::string &out, T value)
+{
+  out.append (reinterpret_cast<const char *> (&value), sizeof (value));
+}
+
+static void
+putString (std::string &out, const std::string &str)
+{
+  put<uint32_t> (out, str.size ());
+  out.append (str);
+}
+
+struct BinaryTraceFormat::Deflater
+{
+#ifdef HAVE_ZLIB
+  z_stream stream;
+#endif
+};
+
+BinaryTraceFormat::BinaryTraceFormat (bool compress) : m_deflater (nullptr)
+{
+  if (!compress)
+    return;
+
+#ifdef HAVE_ZLIB
+  m_deflater = new Deflater ();
+  int ret = deflateInit (&m_deflater->stream, Z_DEFAULT_COMPRESSION);
+  NS_ABORT_MSG_IF (ret != Z_OK, "Cannot initialize zlib");
+#else
+  NS_ABORT_MSG ("Compressed traces need zlib, not found when configuring");
+#endif
+}
+
+BinaryTraceFormat::~BinaryTraceFormat ()
+{
+#ifdef HAVE_ZLIB
+  if (m_deflater)
+    deflateEnd (&m_deflater->stream);
+#endif
+  delete m_deflater;
+}
+
+std::string
+BinaryTraceFormat::GetExtension (void) const
+{
+  return "bin";
+}
+
+void
+BinaryTraceFormat::FormatHeader (std::string &out, const TraceSchema &schema,
+                                 const std::vector<std::string> &entities)
+{
+  out.append (MAGIC, sizeof (MAGIC));
+  put<uint32_t> (out, VERSION);
+  put<uint8_t> (out, m_deflater ? ZLIB : 0);
+
+  putString (out, schema.entityColumn);
+  put<uint32_t> (out, schema.columns.size ());
+  for (const TraceColumn &column : schema.columns)
+    {
+      putString (out, column.name);
+      put<uint8_t> (out, column.type);
+    }
+
+  put<uint32_t> (out, entities.size ());
+  for (const std::string &entity : entities)
+    putString (out, entity);
+}
+
+void
+BinaryTraceFormat::FormatRow (std::string &out, const TraceSchema &schema,
+                              const std::vector<std::string> &entities, const TraceRow &row)
+{
+  if (!m_rows.empty () && m_rows.back ().time != row.time)
+    FormatBlock (out, schema);
+  m_rows.push_back (row);
+}
+
+void
+BinaryTraceFormat::FormatFooter (std::string &out, const TraceSchema &schema)
+{
+  if (!m_rows.empty ())
+    FormatBlock (out, schema);
+  if (m_deflater)
+    Compress (out, true);
+}
+
+void
+BinaryTraceFormat::FormatBlock (std::string &out, const TraceSchema &schema)
+{
+  std::string &block = m_deflater ? m_block : out;
+
+  put<double> (block, m_rows.front ().time);
+  put<uint32_t> (block, m_rows.size ());
+  for (const TraceRow &row : m_rows)
+    put<uint32_t> (block, row.entity);
+
+  // Both value types are 8 bytes wide, written as they are
+  for (size_t i = 0; i < schema.columns.size (); i++)
+    {
+      for (const TraceRow &row : m_rows)
+        put<uint64_t> (block, row.values[i].integer);
+    }
+  m_rows.clear ();
+
+  if (m_deflater)
+    Compress (out, false);
+}
+
+void
+BinaryTraceFormat::Compress (std::string &out, bool finish)
+{
+#ifdef HAVE_ZLIB
+  z_stream &stream = m_deflater->stream;
+  stream.next_in = reinterpret_cast<Bytef *> (&m_block[0]);
+  stream.avail_in = m_block.size ();
+
+  char buf[1 << 14];
+  do
+    {
+      stream.next_out = reinterpret_cast<Bytef *> (buf);
+      stream.avail_out = sizeof (buf);
+      int ret = deflate (&stream, finish ? Z_FINISH : Z_NO_FLUSH);
+      NS_ASSERT (ret != Z_STREAM_ERROR);
+      out.append (buf, sizeof (buf) - stream.avail_out);
+    }
+  while (stream.avail_out == 0);
+#endif
+  m_block.clear ();
+}
+
+} // namespace ns3
@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "kll-sketch.h"
+
+namespace ns3 {
+
+// Capacity ratio between consecutive levels
+static const double CAPACITY_DECAY = 2.0 / 3.0;
+
+// Lowest capacity of a level
+static const uint32_t MIN_CAPACITY = 2;
+
+// Seed of the offsets, the same for every sketch
+static const uint64_t OFFSET_SEED = 0x9e3779b97f4a7c15;
+
+KllSketch::KllSketch (uint32_t k) : m_k (k), m_n (0), m_levels (1), m_random (OFFSET_SEED)
+{
+}
+
+void
+KllSketch::Update (double value)
+{
+  m_levels[0].push_back (value);
+  m_n++;
+  Compress ();
+}
+
+void
+KllSketch::Merge (const KllSketch &other)
+{
+  if (other.m_levels.size () > m_levels.size ())
+    m_levels.resize (other.m_levels.size ());
+
+  for (size_t h = 0; h < other.m_levels.size (); h++)
+    m_levels[h].insert (m_levels[h].end (), other.m_levels[h].begin (), other.m_levels[h].end ());
+  m_n += other.m_n;
+  Compress ();
+}
+
+double
+KllSketch::GetQuantile (double rank) const
+{
+  std::vector<std::pair<double, uint64_t>> weighted;
+  for (size_t h = 0; h < m_levels.size (); h++)
+    {
+      for (double value : m_levels[h])
+        weighted.push_back ({value, uint64_t (1) << h});
+    }
+  if (weighted.empty ())
+    return std::numeric_limits<double>::quiet_NaN ();
+
+  std::sort (weighted.begin (), weighted.end ());
+  uint64_t total = 0;
+  for (const std::pair<double, uint64_t> &item : weighted)
+    total += item.second;
+
+  // Nearest rank, the first value covering rank * total of the weight
+  double target = std::max (1.0, std::ceil (rank * total));
+  uint64_t cumulative = 0;
+  for (const std::pair<double, uint64_t> &item : weighted)
+    {
+      cumulative += item.second;
+      if (cumulative >= target)
+        return item.first;
+    }
+  return weighted.back ().first;
+}
+
+uint64_t
+KllSketch::GetN (void) const
+{
+  return m_n;
+}
+
+uint32_t
+KllSketch::GetCapacity (uint32_t level) const
+{
+  uint32_t depth = m_levels.size () - level - 1;
+  double capacity = std::ceil (m_k * std::pow (CAPACITY_DECAY, depth));
+  return std::max<uint32_t> (MIN_CAPACITY, capacity);
+}
+
+void
+KllSketch::Compress (void)
+{
+  for (uint32_t h = 0; h < m_levels.size (); h++)
+    {
+      while (m_levels[h].size () >= GetCapacity (h))
+        {
+          if (h + 1 == m_levels.size ())
+            m_levels.emplace_back ();
+          Compact (h);
+        }
+    }
+}
+
+void
+KllSketch::Compact (uint32_t level)
+{
+  std::vector<double> &items = m_levels[level];
+  std::vector<double> &next = m_levels[level + 1];
+  std::sort (items.begin (), items.end ());
+
+  // An odd value out stays at its level
+  bool odd = items.size () % 2;
+  for (size_t i = NextOffset (); i + odd < items.size (); i += 2)
+    next.push_back (items[i]);
+
+  double last = items.back ();
+  items.clear ();
+  if (odd)
+    items.push_back (last);
+}
+
+uint32_t
+KllSketch::NextOffset (void)
+{
+  // xorshift64
+  m_random ^= m_random << 13;
+  m_random ^= m_random >> 7;
+  m_random ^= m_random << 17;
+  return m_random >> 63;
+}
+
+} // namespace ns3
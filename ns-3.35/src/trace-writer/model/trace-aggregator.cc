@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include "ns3/abort.h"
+#include "trace-aggregator.h"
+
+namespace ns3 {
+
+// Absorbs rounding when mapping row times to panes
+static const double PANE_EPSILON = 1e-9;
+
+static double
+toDouble (const TraceColumn &column, TraceValue value)
+{
+  return column.type == TraceColumn::REAL ? value.real : value.integer;
+}
+
+TraceAggregator::Pane::Pane (int64_t index, size_t nColumns)
+    : index (index),
+      count (0),
+      min (nColumns),
+      max (nColumns),
+      mean (nColumns),
+      m2 (nColumns)
+{
+}
+
+void
+TraceAggregator::Pane::Add (const TraceSchema &schema, const TraceRow &row)
+{
+  count++;
+  for (size_t i = 0; i < schema.columns.size (); i++)
+    {
+      double value = toDouble (schema.columns[i], row.values[i]);
+
+      // Welford's update
+      double delta = value - mean[i];
+      mean[i] += delta / count;
+      m2[i] += delta * (value - mean[i]);
+      min[i] = count == 1 ? value : std::min (min[i], value);
+      max[i] = count == 1 ? value : std::max (max[i], value);
+      if (!sketches.empty ())
+        sketches[i].Update (value);
+    }
+}
+
+void
+TraceAggregator::Pane::Merge (const Pane &other)
+{
+  if (!other.count)
+    return;
+
+  uint64_t total = count + other.count;
+  for (size_t i = 0; i < mean.size (); i++)
+    {
+      // Chan et al. pairwise update
+      double delta = other.mean[i] - mean[i];
+      mean[i] += delta * other.count / total;
+      m2[i] += other.m2[i] + delta * delta * count * other.count / total;
+      min[i] = count ? std::min (min[i], other.min[i]) : other.min[i];
+      max[i] = count ? std::max (max[i], other.max[i]) : other.max[i];
+      if (!sketches.empty ())
+        sketches[i].Merge (other.sketches[i]);
+    }
+  count = total;
+}
+
+TraceAggregator::TraceAggregator (TraceSchema schema, TraceWindow window)
+    : m_schema (schema), m_window (window)
+{
+  NS_ABORT_MSG_IF (!window.slide.IsStrictlyPositive () || window.size < window.slide,
+                   "Trace windows need a positive slide, up to their size");
+  NS_ABORT_MSG_IF (window.size.GetTimeStep () % window.slide.GetTimeStep (),
+                   "Trace window of " << window.size << " is not a multiple of its "
+                                      << window.slide << " slide");
+  m_nPanes = window.size.GetTimeStep () / window.slide.GetTimeStep ();
+
+  m_summarySchema.entityColumn = schema.entityColumn;
+  m_summarySchema.columns.push_back ({"Count", TraceColumn::INTEGER});
+  for (const TraceColumn &column : schema.columns)
+    {
+      m_summarySchema.columns.push_back ({column.name + "_Min", TraceColumn::REAL});
+      m_summarySchema.columns.push_back ({column.name + "_Max", TraceColumn::REAL});
+      m_summarySchema.columns.push_back ({column.name + "_Mean", TraceColumn::REAL});
+      m_summarySchema.columns.push_back ({column.name + "_Var", TraceColumn::REAL});
+      for (double quantile : window.quantiles)
+        {
+          NS_ABORT_MSG_IF (quantile < 0 || quantile > 1,
+                           "Trace quantile " << quantile << " is not in [0, 1]");
+          std::ostringstream name;
+          name << column.name << "_P" << quantile * 100;
+          m_summarySchema.columns.push_back ({name.str (), TraceColumn::REAL});
+        }
+    }
+  NS_ABORT_MSG_IF (m_summarySchema.columns.size () > TraceRow::MAX_COLUMNS,
+                   "Summaries of " << schema.entityColumn << " traces need "
+                                   << m_summarySchema.columns.size () << " columns, up to "
+                                   << TraceRow::MAX_COLUMNS << " fit");
+}
+
+const TraceSchema &
+TraceAggregator::GetSchema (void) const
+{
+  return m_summarySchema;
+}
+
+void
+TraceAggregator::Add (const TraceRow &row, std::vector<TraceRow> &summaries)
+{
+  if (row.entity >= m_panes.size ())
+    m_panes.resize (row.entity + 1);
+
+  std::deque<Pane> &panes = m_panes[row.entity];
+  int64_t index = std::floor (row.time / m_window.slide.GetSeconds () + PANE_EPSILON);
+  if (!panes.empty () && panes.back ().index < index)
+    Close (row.entity, index, summaries);
+
+  if (panes.empty () || panes.back ().index != index)
+    {
+      panes.emplace_back (index, m_schema.columns.size ());
+      if (!m_window.quantiles.empty ())
+        panes.back ().sketches.resize (m_schema.columns.size ());
+    }
+  panes.back ().Add (m_schema, row);
+}
+
+void
+TraceAggregator::Flush (std::vector<TraceRow> &summaries)
+{
+  for (uint32_t entity = 0; entity < m_panes.size (); entity++)
+    {
+      if (!m_panes[entity].empty ())
+        Close (entity, m_panes[entity].back ().index + 1, summaries);
+      m_panes[entity].clear ();
+    }
+}
+
+void
+TraceAggregator::Close (uint32_t entity, int64_t next, std::vector<TraceRow> &summaries)
+{
+  std::deque<Pane> &panes = m_panes[entity];
+
+  // Later windows would not hold any pane
+  int64_t open = panes.back ().index;
+  int64_t last = std::min (next - 1, open + m_nPanes - 1);
+  for (int64_t end = open; end <= last; end++)
+    {
+      while (!panes.empty () && panes.front ().index <= end - m_nPanes)
+        panes.pop_front ();
+      if (panes.empty ())
+        break;
+      Summarize (entity, end, summaries);
+    }
+}
+
+void
+TraceAggregator::Summarize (uint32_t entity, int64_t last, std::vector<TraceRow> &summaries)
+{
+  const std::deque<Pane> &panes = m_panes[entity];
+  Pane window = panes.front ();
+  for (size_t i = 1; i < panes.size (); i++)
+    window.Merge (panes[i]);
+
+  TraceRow row;
+  row.time = (last + 1) * m_window.slide.GetSeconds ();
+  row.entity = entity;
+
+  TraceValue *value = row.values;
+  *value++ = TraceValue (window.count);
+  for (size_t i = 0; i < m_schema.columns.size (); i++)
+    {
+      *value++ = window.min[i];
+      *value++ = window.max[i];
+      *value++ = window.mean[i];
+      *value++ = window.m2[i] / window.count;
+      for (double quantile : m_window.quantiles)
+        *value++ = window.sketches[i].GetQuantile (quantile);
+    }
+  summaries.push_back (row);
+}
+
+} // namespace ns3
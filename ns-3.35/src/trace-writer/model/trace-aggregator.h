@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef TRACE_AGGREGATOR_H
+#define TRACE_AGGREGATOR_H
+
+#include <deque>
+#include <vector>
+#include "ns3/nstime.h"
+#include "ns3/simple-ref-count.h"
+#include "kll-sketch.h"
+#include "trace-format.h"
+
+namespace ns3 {
+
+/**
+ * The windows a trace is summarized over.
+ */
+struct TraceWindow
+{
+  Time size;
+  Time slide; //!< Between windows, their size for tumbling windows
+  std::vector<double> quantiles; //!< Ranks in [0, 1]
+};
+
+/**
+ * \brief Online summaries of the rows of a trace, per entity, over
+ * tumbling or sliding windows.
+ *
+ * Windows are made of panes, tumbling windows one slide long whose
+ * summaries are mergeable: count, min, max, mean, variance and a KllSketch
+ * per column. A window is summarized once a row after it is added, or on
+ * Flush, so no event is scheduled. Summary rows are timed at the end of
+ * their window, even for the partial windows at both ends of the trace, the
+ * last ones closed by Flush ending after the last row. They hold Count, then
+ * per column the _Min, _Max, _Mean, _Var (population variance) and one
+ * _P<percent> per quantile.
+ */
+class TraceAggregator : public SimpleRefCount<TraceAggregator>
+{
+public:
+  /**
+   * \param schema The columns of the rows, aborts if their summaries do not
+   * fit in a TraceRow.
+   * \param window The window size must be a multiple of its slide.
+   */
+  TraceAggregator (TraceSchema schema, TraceWindow window);
+
+  /**
+   * \returns The columns of the summary rows.
+   */
+  const TraceSchema &GetSchema (void) const;
+
+  /**
+   * Add a row, in time order per entity.
+   * \param summaries Where the summaries of the windows it closes are appended.
+   */
+  void Add (const TraceRow &row, std::vector<TraceRow> &summaries);
+
+  /**
+   * Close the open windows, appending their summaries.
+   */
+  void Flush (std::vector<TraceRow> &summaries);
+
+private:
+  struct Pane
+  {
+    Pane (int64_t index, size_t nColumns);
+
+    void Add (const TraceSchema &schema, const TraceRow &row);
+    void Merge (const Pane &other);
+
+    int64_t index; //!< Slides since time 0
+    uint64_t count;
+    std::vector<double> min;
+    std::vector<double> max;
+    std::vector<double> mean;
+    std::vector<double> m2; //!< Sum of squared differences from the mean
+    std::vector<KllSketch> sketches;
+  };
+
+  /**
+   * Summarize the windows ending with the open pane of an entity up to the
+   * pane before the given one.
+   */
+  void Close (uint32_t entity, int64_t next, std::vector<TraceRow> &summaries);
+  void Summarize (uint32_t entity, int64_t last, std::vector<TraceRow> &summaries);
+
+  TraceSchema m_schema;
+  TraceSchema m_summarySchema;
+  TraceWindow m_window;
+  int64_t m_nPanes; //!< Per window
+  std::vector<std::deque<Pane>> m_panes; //!< Per entity, oldest first, the last one open
+};
+
+} // namespace ns3
+
+#endif /* TRACE_AGGREGATOR_H */
@@ -0,0 +1,173 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <charconv>
+#include "ns3/abort.h"
+#include "binary-trace-format.h"
+#include "trace-format.h"
+
+namespace ns3 {
+
+TraceFormat::~TraceFormat ()
+{
+}
+
+Ptr<TraceFormat>
+TraceFormat::Create (std::string name)
+{
+  if (name == "csv")
+    return ns3::Create<CsvTraceFormat> ();
+  if (name == "jsonl")
+    return ns3::Create<JsonLinesTraceFormat> ();
+  if (name == "binary")
+    return ns3::Create<BinaryTraceFormat> ();
+  if (name == "binary-zlib")
+    return ns3::Create<BinaryTraceFormat> (true);
+  NS_ABORT_MSG ("Unknown " << name << " trace format");
+}
+
+void
+TraceFormat::FormatHeader (std::string &out, const TraceSchema &schema,
+                           const std::vector<std::string> &entities)
+{
+}
+
+void
+TraceFormat::FormatFooter (std::string &out, const TraceSchema &schema)
+{
+}
+
+void
+TraceFormat::AppendReal (std::string &out, double value)
+{
+  // Enough for any double in fixed notation
+  char buf[512];
+  std::to_chars_result res = std::to_chars (buf, buf + sizeof (buf), value,
+                                            std::chars_format::fixed, 6);
+  out.append (buf, res.ptr);
+}
+
+void
+TraceFormat::AppendInteger (std::string &out, uint64_t value)
+{
+  char buf[24];
+  std::to_chars_result res = std::to_chars (buf, buf + sizeof (buf), value);
+  out.append (buf, res.ptr);
+}
+
+void
+TraceFormat::AppendValue (std::string &out, const TraceColumn &column, TraceValue value)
+{
+  if (column.type == TraceColumn::REAL)
+    AppendReal (out, value.real);
+  else
+    AppendInteger (out, value.integer);
+}
+
+/*
+ * CSV
+ */
+
+CsvTraceFormat::CsvTraceFormat (char separator) : m_separator (separator)
+{
+}
+
+std::string
+CsvTraceFormat::GetExtension (void) const
+{
+  return "csv";
+}
+
+void
+CsvTraceFormat::FormatHeader (std::string &out, const TraceSchema &schema,
+                              const std::vector<std::string> &entities)
+{
+  out.append ("Time");
+  out.push_back (m_separator);
+  out.append (schema.entityColumn);
+  for (const TraceColumn &column : schema.columns)
+    {
+      out.push_back (m_separator);
+      out.append (column.name);
+    }
+  out.push_back ('\n');
+}
+
+void
+CsvTraceFormat::FormatRow (std::string &out, const TraceSchema &schema,
+                           const std::vector<std::string> &entities, const TraceRow &row)
+{
+  AppendReal (out, row.time);
+  out.push_back (m_separator);
+  out.append (entities[row.entity]);
+  for (size_t i = 0; i < schema.columns.size (); i++)
+    {
+      out.push_back (m_separator);
+      AppendValue (out, schema.columns[i], row.values[i]);
+    }
+  out.push_back ('\n');
+}
+
+/*
+ * JSON lines
+ */
+
+std::string
+JsonLinesTraceFormat::GetExtension (void) const
+{
+  return "jsonl";
+}
+
+void
+JsonLinesTraceFormat::FormatRow (std::string &out, const TraceSchema &schema,
+                                 const std::vector<std::string> &entities, const TraceRow &row)
+{
+  out.append ("{\"Time\":");
+  AppendReal (out, row.time);
+  out.push_back (',');
+  AppendString (out, schema.entityColumn);
+  out.push_back (':');
+  AppendString (out, entities[row.entity]);
+  for (size_t i = 0; i < schema.columns.size (); i++)
+    {
+      out.push_back (',');
+      AppendString (out, schema.columns[i].name);
+      out.push_back (':');
+      AppendValue (out, schema.columns[i], row.values[i]);
+    }
+  out.append ("}\n");
+}
+
+void
+JsonLinesTraceFormat::AppendString (std::string &out, const std::string &str)
+{
+  out.push_back ('"');
+  for (char c : str)
+    {
+      if (c == '"' || c == '\\')
+        out.push_back ('\\');
+      out.push_back (c);
+    }
+  out.push_back ('"');
+}
+
+} // namespace ns3
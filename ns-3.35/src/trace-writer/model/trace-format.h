@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#ifndef TRACE_FORMAT_H
+#define TRACE_FORMAT_H
+
+#include <string>
+#include <vector>
+#include "ns3/simple-ref-count.h"
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+/**
+ * A numeric trace value, its type given by its TraceColumn.
+ */
+union TraceValue
+{
+  TraceValue () : integer (0)
+  {
+  }
+  TraceValue (double value) : real (value)
+  {
+  }
+  TraceValue (uint64_t value) : integer (value)
+  {
+  }
+  TraceValue (uint32_t value) : integer (value)
+  {
+  }
+
+  double real;
+  uint64_t integer;
+};
+
+struct TraceColumn
+{
+  enum Type { REAL, INTEGER };
+
+  std::string name;
+  Type type;
+};
+
+/**
+ * The columns of a trace, after the time and entity name of each row.
+ */
+struct TraceSchema
+{
+  std::string entityColumn; //!< Header of the entity names, e.g. LinkName
+  std::vector<TraceColumn> columns;
+};
+
+struct TraceRow
+{
+  static const uint32_t MAX_COLUMNS = 32; //!< Enough for the summaries of four columns
+
+  double time; //!< Seconds
+  uint32_t entity; //!< Index of the entity name
+  TraceValue values[MAX_COLUMNS];
+};
+
+/**
+ * \brief Output format of a TraceWriter, turning binary rows into bytes.
+ *
+ * Formats append to the output buffer of the writer and are called from its
+ * background thread.
+ */
+class TraceFormat : public SimpleRefCount<TraceFormat>
+{
+public:
+  virtual ~TraceFormat ();
+
+  /**
+   * \param name csv, jsonl, binary or binary-zlib, aborts on other names.
+   */
+  static Ptr<TraceFormat> Create (std::string name);
+
+  /**
+   * \returns The file extension of the format, without the dot.
+   */
+  virtual std::string GetExtension (void) const = 0;
+
+  /**
+   * Called before the first row, once the entities are known.
+   */
+  virtual void FormatHeader (std::string &out, const TraceSchema &schema,
+                             const std::vector<std::string> &entities);
+  virtual void FormatRow (std::string &out, const TraceSchema &schema,
+                          const std::vector<std::string> &entities, const TraceRow &row) = 0;
+  virtual void FormatFooter (std::string &out, const TraceSchema &schema);
+
+protected:
+  /**
+   * Append a value as std::fixed streams do, i.e. with 6 decimals.
+   */
+  static void AppendReal (std::string &out, double value);
+  static void AppendInteger (std::string &out, uint64_t value);
+  static void AppendValue (std::string &out, const TraceColumn &column, TraceValue value);
+};
+
+/**
+ * \brief One line per row, fields separated by a character, after a header
+ * line.
+ */
+class CsvTraceFormat : public TraceFormat
+{
+public:
+  CsvTraceFormat (char separator = ';');
+
+  std::string GetExtension (void) const;
+  void FormatHeader (std::string &out, const TraceSchema &schema,
+                     const std::vector<std::string> &entities);
+  void FormatRow (std::string &out, const TraceSchema &schema,
+                  const std::vector<std::string> &entities, const TraceRow &row);
+
+private:
+  char m_separator;
+};
+
+/**
+ * \brief One JSON object per row, keyed by column name.
+ */
+class JsonLinesTraceFormat : public TraceFormat
+{
+public:
+  std::string GetExtension (void) const;
+  void FormatRow (std::string &out, const TraceSchema &schema,
+                  const std::vector<std::string> &entities, const TraceRow &row);
+
+private:
+  static void AppendString (std::string &out, const std::string &str);
+};
+
+} // namespace ns3
+
+#endif /* TRACE_FORMAT_H */
@@ -0,0 +1,221 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <cstring>
+#include "ns3/abort.h"
+#include "ns3/trace-writer-config.h"
+#include "binary-trace-format.h"
+#include "trace-reader.h"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace ns3 {
+
+// Compressed bytes read from the file at once
+static const size_t INPUT_SIZE = 1 << 16;
+
+struct TraceReader::Inflater
+{
+#ifdef HAVE_ZLIB
+  z_stream stream;
+#endif
+  char input[INPUT_SIZE];
+  bool end; //!< Whether the end of the stream was reached
+};
+
+TraceReader::TraceReader (std::string path)
+    : m_path (path), m_file (path, std::ios::binary), m_inflater (nullptr), m_next (0)
+{
+  NS_ABORT_MSG_IF (!m_file, "Cannot read " << path);
+
+  char magic[sizeof (BinaryTraceFormat::MAGIC)];
+  uint32_t version;
+  uint8_t flags;
+  Get (magic);
+  Get (version);
+  Get (flags);
+  NS_ABORT_MSG_IF (memcmp (magic, BinaryTraceFormat::MAGIC, sizeof (magic)),
+                   path << " is not a binary trace");
+  NS_ABORT_MSG_IF (version != BinaryTraceFormat::VERSION,
+                   path << " is a version " << version << " trace, expected version "
+                        << BinaryTraceFormat::VERSION);
+
+  uint32_t nColumns;
+  GetString (m_schema.entityColumn);
+  Get (nColumns);
+  NS_ABORT_MSG_IF (nColumns > TraceRow::MAX_COLUMNS, "Corrupted trace " << path);
+  m_schema.columns.resize (nColumns);
+  for (TraceColumn &column : m_schema.columns)
+    {
+      uint8_t type;
+      GetString (column.name);
+      Get (type);
+      NS_ABORT_MSG_IF (type != TraceColumn::REAL && type != TraceColumn::INTEGER,
+                       "Corrupted trace " << path);
+      column.type = TraceColumn::Type (type);
+    }
+
+  uint32_t nEntities;
+  Get (nEntities);
+  m_entities.resize (nEntities);
+  for (std::string &entity : m_entities)
+    GetString (entity);
+
+  if (flags & BinaryTraceFormat::ZLIB)
+    {
+#ifdef HAVE_ZLIB
+      m_inflater = new Inflater ();
+      NS_ABORT_MSG_IF (inflateInit (&m_inflater->stream) != Z_OK, "Cannot initialize zlib");
+#else
+      NS_ABORT_MSG ("Compressed traces need zlib, not found when configuring");
+#endif
+    }
+}
+
+TraceReader::~TraceReader ()
+{
+#ifdef HAVE_ZLIB
+  if (m_inflater)
+    inflateEnd (&m_inflater->stream);
+#endif
+  delete m_inflater;
+}
+
+const TraceSchema &
+TraceReader::GetSchema (void) const
+{
+  return m_schema;
+}
+
+const std::vector<std::string> &
+TraceReader::GetEntities (void) const
+{
+  return m_entities;
+}
+
+bool
+TraceReader::IsCompressed (void) const
+{
+  return m_inflater != nullptr;
+}
+
+bool
+TraceReader::ReadBlock (TraceBlock &block)
+{
+  if (!Read (&block.time, sizeof (block.time)))
+    return false;
+
+  uint32_t nRows;
+  Get (nRows);
+  block.entities.resize (nRows);
+  NS_ABORT_MSG_IF (!Read (block.entities.data (), nRows * sizeof (uint32_t)),
+                   "Truncated trace " << m_path);
+  for (uint32_t entity : block.entities)
+    NS_ABORT_MSG_IF (entity >= m_entities.size (), "Corrupted trace " << m_path);
+
+  block.columns.resize (m_schema.columns.size ());
+  for (std::vector<TraceValue> &column : block.columns)
+    {
+      column.resize (nRows);
+      NS_ABORT_MSG_IF (!Read (column.data (), nRows * sizeof (TraceValue)),
+                       "Truncated trace " << m_path);
+    }
+  return true;
+}
+
+bool
+TraceReader::ReadRow (TraceRow &row)
+{
+  while (m_next == m_block.entities.size ())
+    {
+      if (!ReadBlock (m_block))
+        return false;
+      m_next = 0;
+    }
+
+  row.time = m_block.time;
+  row.entity = m_block.entities[m_next];
+  for (size_t i = 0; i < m_block.columns.size (); i++)
+    row.values[i] = m_block.columns[i][m_next];
+  m_next++;
+  return true;
+}
+
+bool
+TraceReader::Read (void *data, size_t size)
+{
+  if (size == 0)
+    return true;
+
+  size_t done = 0;
+  if (!m_inflater)
+    {
+      m_file.read (static_cast<char *> (data), size);
+      done = m_file.gcount ();
+    }
+#ifdef HAVE_ZLIB
+  else
+    {
+      z_stream &stream = m_inflater->stream;
+      while (done < size && !m_inflater->end)
+        {
+          if (stream.avail_in == 0)
+            {
+              m_file.read (m_inflater->input, INPUT_SIZE);
+              stream.next_in = reinterpret_cast<Bytef *> (m_inflater->input);
+              stream.avail_in = m_file.gcount ();
+              NS_ABORT_MSG_IF (stream.avail_in == 0, "Truncated trace " << m_path);
+            }
+
+          stream.next_out = static_cast<Bytef *> (data) + done;
+          stream.avail_out = size - done;
+          int ret = inflate (&stream, Z_NO_FLUSH);
+          NS_ABORT_MSG_IF (ret != Z_OK && ret != Z_STREAM_END, "Corrupted trace " << m_path);
+          done = size - stream.avail_out;
+          m_inflater->end = ret == Z_STREAM_END;
+        }
+    }
+#endif
+
+  NS_ABORT_MSG_IF (done != 0 && done < size, "Truncated trace " << m_path);
+  return done == size;
+}
+
+template <typename T>
+void
+TraceReader::Get (T &value)
+{
+  NS_ABORT_MSG_IF (!Read (&value, sizeof (value)), "Truncated trace " << m_path);
+}
+
+void
+TraceReader::GetString (std::string &str)
+{
+  uint32_t size;
+  Get (size);
+  str.resize (size);
+  NS_ABORT_MSG_IF (!Read (&str[0], size), "Truncated trace " << m_path);
+}
+
+} // namespace ns3
@@ -0,0 +1,232 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "trace-writer.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TraceWriter");
+
+// Idle background thread sleeps, doubling up to this
+static const std::chrono::microseconds MAX_IDLE_SLEEP (1000);
+
+// Guards the registered writers, drained under it, and the thread lifetime
+static std::mutex g_mutex;
+static std::vector<TraceWriter *> g_writers;
+static std::thread g_thread;
+static std::atomic<bool> g_running (false);
+
+TraceWriter::TraceWriter (std::string path, std::string format, TraceSchema schema,
+                          uint32_t capacity)
+    : m_format (TraceFormat::Create (format)),
+      m_schema (schema),
+      m_buffer (capacity),
+      m_writing (false),
+      m_formatting (false),
+      m_closed (false)
+{
+  NS_LOG_FUNCTION (this << path << format << capacity);
+  NS_ABORT_MSG_IF (schema.columns.size () > TraceRow::MAX_COLUMNS,
+                   "Traces hold up to " << TraceRow::MAX_COLUMNS << " columns");
+
+  path += "." + m_format->GetExtension ();
+  m_file.open (path, std::ios::binary | std::ios::trunc);
+  NS_ABORT_MSG_IF (!m_file, "Cannot write " << path);
+
+  Register (this);
+  Simulator::ScheduleDestroy (&TraceWriter::Close, Ptr<TraceWriter> (this));
+}
+
+TraceWriter::~TraceWriter ()
+{
+  NS_LOG_FUNCTION (this);
+  Close ();
+}
+
+uint32_t
+TraceWriter::AddEntity (std::string name)
+{
+  NS_ABORT_MSG_IF (m_writing, "Trace entity " << name << " added after the first row");
+  m_entities.push_back (name);
+  return m_entities.size () - 1;
+}
+
+void
+TraceWriter::SetWindow (TraceWindow window)
+{
+  NS_LOG_FUNCTION (this << window.size << window.slide);
+  NS_ABORT_MSG_IF (m_writing, "Trace window set after the first row");
+  m_aggregator = Create<TraceAggregator> (m_schema, window);
+}
+
+void
+TraceWriter::Write (uint32_t entity, std::initializer_list<TraceValue> values)
+{
+  NS_ASSERT (entity < m_entities.size () && values.size () == m_schema.columns.size ());
+  m_writing = true;
+
+  TraceRow row;
+  row.time = Simulator::Now ().GetSeconds ();
+  row.entity = entity;
+  std::copy (values.begin (), values.end (), row.values);
+
+  while (!m_buffer.Push (row))
+    std::this_thread::yield ();
+}
+
+void
+TraceWriter::Close (void)
+{
+  if (m_closed)
+    return;
+  NS_LOG_FUNCTION (this);
+
+  // The background thread is done with this writer, the rest is drained here
+  Unregister (this);
+  Drain ();
+
+  if (!m_formatting)
+    m_format->FormatHeader (m_batch, GetFileSchema (), m_entities);
+  if (m_aggregator)
+    {
+      m_aggregator->Flush (m_summaries);
+      for (const TraceRow &summary : m_summaries)
+        m_format->FormatRow (m_batch, GetFileSchema (), m_entities, summary);
+      m_summaries.clear ();
+    }
+  m_format->FormatFooter (m_batch, GetFileSchema ());
+  Flush ();
+  m_file.close ();
+  m_closed = true;
+}
+
+void
+TraceWriter::Run (void)
+{
+  std::chrono::microseconds sleep (1);
+  while (g_running.load (std::memory_order_acquire))
+    {
+      bool busy = false;
+      {
+        std::lock_guard<std::mutex> lock (g_mutex);
+        for (TraceWriter *writer : g_writers)
+          busy |= writer->Drain ();
+      }
+
+      if (busy)
+        sleep = std::chrono::microseconds (1);
+      else
+        {
+          std::this_thread::sleep_for (sleep);
+          sleep = std::min (sleep * 2, MAX_IDLE_SLEEP);
+        }
+    }
+}
+
+void
+TraceWriter::Register (TraceWriter *writer)
+{
+  std::lock_guard<std::mutex> lock (g_mutex);
+  g_writers.push_back (writer);
+  if (!g_running.load (std::memory_order_relaxed))
+    {
+      g_running.store (true, std::memory_order_release);
+      g_thread = std::thread (&TraceWriter::Run);
+    }
+}
+
+void
+TraceWriter::Unregister (TraceWriter *writer)
+{
+  std::thread thread;
+  {
+    std::lock_guard<std::mutex> lock (g_mutex);
+    g_writers.erase (std::find (g_writers.begin (), g_writers.end (), writer));
+    if (g_writers.empty ())
+      {
+        g_running.store (false, std::memory_order_release);
+        thread.swap (g_thread);
+      }
+  }
+
+  if (thread.joinable ())
+    thread.join ();
+}
+
+bool
+TraceWriter::Drain (void)
+{
+  bool drained = false;
+  while (const TraceRow *row = m_buffer.Front ())
+    {
+      if (!m_formatting)
+        {
+          m_format->FormatHeader (m_batch, GetFileSchema (), m_entities);
+          m_formatting = true;
+        }
+
+      Format (*row);
+      m_buffer.Pop ();
+      drained = true;
+
+      if (m_batch.size () >= BATCH_SIZE)
+        Flush ();
+    }
+  return drained;
+}
+
+void
+TraceWriter::Format (const TraceRow &row)
+{
+  if (!m_aggregator)
+    {
+      m_format->FormatRow (m_batch, m_schema, m_entities, row);
+      return;
+    }
+
+  m_aggregator->Add (row, m_summaries);
+  for (const TraceRow &summary : m_summaries)
+    m_format->FormatRow (m_batch, GetFileSchema (), m_entities, summary);
+  m_summaries.clear ();
+}
+
+void
+TraceWriter::Flush (void)
+{
+  m_file.write (m_batch.data (), m_batch.size ());
+  m_batch.clear ();
+}
+
+const TraceSchema &
+TraceWriter::GetFileSchema (void) const
+{
+  return m_aggregator ? m_aggregator->GetSchema () : m_schema;
+}
+
+} // namespace ns3
@@ -0,0 +1,302 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * The GPLv2 License (GPLv2)
+ *
+ * Copyright (c) 2024 Rui Pedro C. Monteiro
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http: //www.gnu.org/licenses/>.
+ *
+ * Author: Rui Pedro C. Monteiro <rui.p.monteiro@inesctec.pt>
+ */
+
+#include <fstream>
+#include "ns3/binary-trace-format.h"
+#include "ns3/kll-sketch.h"
+#include "ns3/trace-aggregator.h"
+#include "ns3/trace-reader.h"
+#include "ns3/trace-writer-config.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup trace-writer-tests
+ * Write a binary trace of a few ticks and read it back.
+ */
+class BinaryTraceFormatTestCase : public TestCase
+{
+public:
+  BinaryTraceFormatTestCase (bool compress);
+
+private:
+  virtual void DoRun (void);
+
+  bool m_compress;
+};
+
+BinaryTraceFormatTestCase::BinaryTraceFormatTestCase (bool compress)
+    : TestCase (compress ? "Compressed binary trace round trip" : "Binary trace round trip"),
+      m_compress (compress)
+{
+}
+
+void
+BinaryTraceFormatTestCase::DoRun (void)
+{
+  TraceSchema schema;
+  schema.entityColumn = "LinkName";
+  schema.columns.push_back ({"Bytes", TraceColumn::INTEGER});
+  schema.columns.push_back ({"Usage", TraceColumn::REAL});
+  std::vector<std::string> entities = {"S1-S2", "S2-S3"};
+
+  // Three ticks, the last one without the first entity
+  std::vector<TraceRow> rows (5);
+  double times[5] = {1.0, 1.0, 2.0, 2.0, 3.5};
+  uint32_t rowEntities[5] = {0, 1, 0, 1, 1};
+  for (size_t i = 0; i < rows.size (); i++)
+    {
+      rows[i].time = times[i];
+      rows[i].entity = rowEntities[i];
+      rows[i].values[0] = TraceValue (uint64_t (1000 * i + 7));
+      rows[i].values[1] = TraceValue (0.125 * i);
+    }
+
+  BinaryTraceFormat format (m_compress);
+  std::string out;
+  format.FormatHeader (out, schema, entities);
+  for (const TraceRow &row : rows)
+    format.FormatRow (out, schema, entities, row);
+  format.FormatFooter (out, schema);
+
+  std::string path = CreateTempDirFilename ("trace.bin");
+  std::ofstream file (path, std::ios::binary);
+  file.write (out.data (), out.size ());
+  file.close ();
+
+  TraceReader reader (path);
+  NS_TEST_ASSERT_MSG_EQ (reader.IsCompressed (), m_compress, "Wrong compression flag");
+  NS_TEST_ASSERT_MSG_EQ (reader.GetSchema ().entityColumn, "LinkName", "Wrong entity column");
+  NS_TEST_ASSERT_MSG_EQ (reader.GetSchema ().columns.size (), 2, "Wrong number of columns");
+  for (size_t i = 0; i < schema.columns.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (reader.GetSchema ().columns[i].name, schema.columns[i].name,
+                             "Wrong name of column " << i);
+      NS_TEST_ASSERT_MSG_EQ (reader.GetSchema ().columns[i].type, schema.columns[i].type,
+                             "Wrong type of column " << i);
+    }
+  NS_TEST_ASSERT_MSG_EQ (reader.GetEntities ().size (), 2, "Wrong number of entities");
+  for (size_t i = 0; i < entities.size (); i++)
+    NS_TEST_ASSERT_MSG_EQ (reader.GetEntities ()[i], entities[i], "Wrong entity " << i);
+
+  TraceBlock block;
+  size_t sizes[3] = {2, 2, 1};
+  size_t next = 0;
+  for (size_t tick = 0; tick < 3; tick++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (reader.ReadBlock (block), true, "Missing tick " << tick);
+      NS_TEST_ASSERT_MSG_EQ (block.time, rows[next].time, "Wrong time of tick " << tick);
+      NS_TEST_ASSERT_MSG_EQ (block.entities.size (), sizes[tick], "Wrong rows of tick " << tick);
+      NS_TEST_ASSERT_MSG_EQ (block.columns.size (), 2, "Wrong columns of tick " << tick);
+      for (size_t i = 0; i < sizes[tick]; i++, next++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (block.entities[i], rows[next].entity,
+                                 "Wrong entity of row " << next);
+          NS_TEST_ASSERT_MSG_EQ (block.columns[0][i].integer, rows[next].values[0].integer,
+                                 "Wrong Bytes of row " << next);
+          NS_TEST_ASSERT_MSG_EQ (block.columns[1][i].real, rows[next].values[1].real,
+                                 "Wrong Usage of row " << next);
+        }
+    }
+  NS_TEST_ASSERT_MSG_EQ (reader.ReadBlock (block), false, "Trace longer than written");
+
+  // Row by row, in the order written
+  TraceReader rowReader (path);
+  TraceRow row;
+  for (size_t i = 0; i < rows.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (rowReader.ReadRow (row), true, "Missing row " << i);
+      NS_TEST_ASSERT_MSG_EQ (row.time, rows[i].time, "Wrong time of row " << i);
+      NS_TEST_ASSERT_MSG_EQ (row.entity, rows[i].entity, "Wrong entity of row " << i);
+      NS_TEST_ASSERT_MSG_EQ (row.values[0].integer, rows[i].values[0].integer,
+                             "Wrong Bytes of row " << i);
+      NS_TEST_ASSERT_MSG_EQ (row.values[1].real, rows[i].values[1].real,
+                             "Wrong Usage of row " << i);
+    }
+  NS_TEST_ASSERT_MSG_EQ (rowReader.ReadRow (row), false, "Trace longer than written");
+}
+
+/**
+ * \ingroup trace-writer-tests
+ * Summarize a ramp over tumbling or sliding windows.
+ */
+class TraceAggregatorTestCase : public TestCase
+{
+public:
+  TraceAggregatorTestCase (bool sliding);
+
+private:
+  virtual void DoRun (void);
+
+  bool m_sliding;
+};
+
+TraceAggregatorTestCase::TraceAggregatorTestCase (bool sliding)
+    : TestCase (sliding ? "Sliding window summaries" : "Tumbling window summaries"),
+      m_sliding (sliding)
+{
+}
+
+void
+TraceAggregatorTestCase::DoRun (void)
+{
+  TraceSchema schema;
+  schema.entityColumn = "LinkName";
+  schema.columns.push_back ({"Usage", TraceColumn::REAL});
+  TraceWindow window = {Seconds (10), Seconds (m_sliding ? 5 : 10), {}};
+  TraceAggregator aggregator (schema, window);
+
+  // Value t every second from 0 s to 19 s, its entity 1 twin doubled
+  std::vector<TraceRow> summaries;
+  for (uint32_t t = 0; t < 20; t++)
+    {
+      TraceRow row;
+      row.time = t;
+      for (row.entity = 0; row.entity < 2; row.entity++)
+        {
+          row.values[0] = TraceValue (double (t * (row.entity + 1)));
+          aggregator.Add (row, summaries);
+        }
+    }
+  aggregator.Flush (summaries);
+
+  // Population variance of n consecutive integers: (n^2 - 1) / 12
+  struct Summary
+  {
+    double time;
+    uint64_t count;
+    double min;
+    double max;
+    double mean;
+    double var;
+  };
+  std::vector<Summary> expected;
+  if (m_sliding)
+    expected = {{5, 5, 0, 4, 2, 2},
+                {10, 10, 0, 9, 4.5, 8.25},
+                {15, 10, 5, 14, 9.5, 8.25},
+                {20, 10, 10, 19, 14.5, 8.25}};
+  else
+    expected = {{10, 10, 0, 9, 4.5, 8.25}, {20, 10, 10, 19, 14.5, 8.25}};
+
+  NS_TEST_ASSERT_MSG_EQ (aggregator.GetSchema ().columns.size (), 5, "Wrong summary columns");
+  NS_TEST_ASSERT_MSG_EQ (summaries.size (), 2 * expected.size (), "Wrong number of summaries");
+  for (uint32_t entity = 0; entity < 2; entity++)
+    {
+      size_t n = 0;
+      for (const TraceRow &row : summaries)
+        {
+          if (row.entity != entity)
+            continue;
+          const Summary &summary = expected[n++];
+          double scale = entity + 1;
+          NS_TEST_ASSERT_MSG_EQ (row.time, summary.time, "Wrong window end");
+          NS_TEST_ASSERT_MSG_EQ (row.values[0].integer, summary.count,
+                                 "Wrong Count at " << row.time);
+          NS_TEST_ASSERT_MSG_EQ_TOL (row.values[1].real, scale * summary.min, 1e-9,
+                                     "Wrong Min at " << row.time);
+          NS_TEST_ASSERT_MSG_EQ_TOL (row.values[2].real, scale * summary.max, 1e-9,
+                                     "Wrong Max at " << row.time);
+          NS_TEST_ASSERT_MSG_EQ_TOL (row.values[3].real, scale * summary.mean, 1e-9,
+                                     "Wrong Mean at " << row.time);
+          NS_TEST_ASSERT_MSG_EQ_TOL (row.values[4].real, scale * scale * summary.var, 1e-9,
+                                     "Wrong Var at " << row.time);
+        }
+      NS_TEST_ASSERT_MSG_EQ (n, expected.size (), "Wrong summaries of entity " << entity);
+    }
+}
+
+/**
+ * \ingroup trace-writer-tests
+ * Check the quantiles of a KllSketch against the exact ones of a known
+ * distribution.
+ */
+class KllSketchTestCase : public TestCase
+{
+public:
+  KllSketchTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+KllSketchTestCase::KllSketchTestCase () : TestCase ("KLL sketch rank error")
+{
+}
+
+void
+KllSketchTestCase::DoRun (void)
+{
+  // Exact while it holds fewer than k values
+  KllSketch small;
+  for (uint32_t i = 1; i <= 100; i++)
+    small.Update (101 - i);
+  NS_TEST_ASSERT_MSG_EQ (small.GetQuantile (0.0), 1, "Wrong minimum of a small sketch");
+  NS_TEST_ASSERT_MSG_EQ (small.GetQuantile (0.5), 50, "Wrong median of a small sketch");
+  NS_TEST_ASSERT_MSG_EQ (small.GetQuantile (1.0), 100, "Wrong maximum of a small sketch");
+
+  // A permutation of 0 to n - 1, split in two merged sketches
+  const uint32_t n = 100000;
+  KllSketch sketch;
+  KllSketch other;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      double value = (uint64_t (i) * 7919) % n;
+      (i % 2 ? other : sketch).Update (value);
+    }
+  sketch.Merge (other);
+  NS_TEST_ASSERT_MSG_EQ (sketch.GetN (), n, "Wrong number of updates");
+
+  // Value v has the exact rank (v + 1) / n
+  double bound = 1.65 / KllSketch::DEFAULT_K;
+  double ranks[] = {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99};
+  for (double rank : ranks)
+    {
+      double value = sketch.GetQuantile (rank);
+      NS_TEST_ASSERT_MSG_EQ_TOL ((value + 1) / n, rank, bound,
+                                 "Rank error above the bound at " << rank);
+    }
+}
+
+/**
+ * \ingroup trace-writer-tests
+ * TestSuite of the trace-writer module.
+ */
+class TraceWriterTestSuite : public TestSuite
+{
+public:
+  TraceWriterTestSuite ();
+};
+
+TraceWriterTestSuite::TraceWriterTestSuite () : TestSuite ("trace-writer", UNIT)
+{
+  AddTestCase (new BinaryTraceFormatTestCase (false), TestCase::QUICK);
+#ifdef HAVE_ZLIB
+  AddTestCase (new BinaryTraceFormatTestCase (true), TestCase::QUICK);
+#endif
+  AddTestCase (new TraceAggregatorTestCase (false), TestCase::QUICK);
+  AddTestCase (new TraceAggregatorTestCase (true), TestCase::QUICK);
+  AddTestCase (new KllSketchTestCase, TestCase::QUICK);
+}
+
+static TraceWriterTestSuite g_traceWriterTestSuite;
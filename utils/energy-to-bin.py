@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+
+# Converts flex/estimate JSON files into the binary series format served by
+# the EnergyAPI through a memory mapping (see src/energy-api/model/series-file.h).
+
+import argparse
+import json
+import re
+import struct
+
+MAGIC = b"FXSERIES"
+VERSION = 1
+HEADER = struct.Struct("<8sIIQQ")
+ENTRY = struct.Struct("<QQqqIIII")
+
+BOUNDARIES = {"wrap": 0, "hold": 1}
+INTERPOLATIONS = {"step": 0, "linear": 1}
+
+UNITS = {
+    "y": 365 * 24 * 3600 * 10**9,
+    "d": 24 * 3600 * 10**9,
+    "h": 3600 * 10**9,
+    "min": 60 * 10**9,
+    "s": 10**9,
+    "ms": 10**6,
+    "us": 10**3,
+    "ns": 1,
+}
+
+
+def parse_args():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("input", type=str)
+    parser.add_argument("output", type=str)
+    return parser.parse_args()
+
+
+def parse_time(value):
+    match = re.fullmatch(r"\s*([-+0-9.eE]+)\s*([a-z]*)\s*", value)
+    if not match or match.group(2) not in UNITS.keys() | {""}:
+        raise ValueError(f"invalid time {value}")
+    return int(float(match.group(1)) * UNITS[match.group(2) or "s"])
+
+
+def parse_series(series):
+    if isinstance(series, list):
+        return series, 0, UNITS["min"], 0, 0
+
+    return (
+        series["values"],
+        parse_time(series.get("start", "0s")),
+        parse_time(series.get("step", "1min")),
+        BOUNDARIES[series.get("boundary", "wrap")],
+        INTERPOLATIONS[series.get("interpolation", "step")],
+    )
+
+
+def align(offset):
+    return (offset + 7) & ~7
+
+
+def convert(input_path, output_path):
+    with open(input_path) as file:
+        data = json.load(file)
+
+    names = b""
+    entries = []
+    columns = []
+    for name, series in data.items():
+        values, start, step, boundary, interpolation = parse_series(series)
+        encoded = name.encode()
+        entries.append(
+            [0, len(values), start, step, len(names), len(encoded), boundary, interpolation]
+        )
+        columns.append(struct.pack(f"<{len(values)}f", *values))
+        names += encoded
+
+    names_offset = HEADER.size + ENTRY.size * len(entries)
+    offset = align(names_offset + len(names))
+    for entry, column in zip(entries, columns):
+        entry[0] = offset
+        offset = align(offset + len(column))
+
+    with open(output_path, "wb") as file:
+        file.write(HEADER.pack(MAGIC, VERSION, len(entries), names_offset, len(names)))
+        for entry in entries:
+            file.write(ENTRY.pack(*entry))
+        file.write(names)
+        for entry, column in zip(entries, columns):
+            file.write(b"\0" * (entry[0] - file.tell()))
+            file.write(column)
+
+
+if __name__ == "__main__":
+    args = parse_args()
+    convert(args.input, args.output)